@@ -54,6 +54,8 @@
 
 #include "interpret.hpp"
 #include <hls_stream.h>
+#include "utils.hpp"
+#include "mac.hpp"
 #include <functional>
 
 namespace comp{
@@ -165,6 +167,17 @@ public:
   }
 };
 
+/**
+ * A no-op activation accumulating into the smallest type that holds the sum
+ * of N products of the operand types TC and TD, see MacAccumulator.
+ *
+ * Used by the MVAU and VVAU overloads that take no activation.
+ */
+template<unsigned N, typename TC, typename TD>
+class MacPassThroughActivation : public PassThroughActivation<typename MacAccumulator<N, TC, TD>::type> {
+  static_assert(MacAccumulator<N, TC, TD>::known, "The accumulator cannot be inferred from the operand types.");
+};
+
 /**
  * Use a simple global threshold comparison as activation function.
  *
@@ -222,6 +235,96 @@ public:
 };
 
 
+/*!
+ * Use a per-row threshold comparison with runtime-writable thresholds.
+ *
+ * Behaves like ThresholdsActivation but references an external memory of
+ * BANKS threshold sets, e.g. a top-level array argument mapped to an AXI-lite
+ * or BRAM interface that the host writes at runtime. The bank in use is
+ * selected at construction so that new thresholds can be loaded into another
+ * bank while the current batch is processed. The NumTH thresholds of all PE
+ * rows of a neuron fold are packed into one word, threshold i of lane pe in
+ * bits [(pe*NumTH+i+1)*TA::width-1:(pe*NumTH+i)*TA::width], so that a single
+ * memory port serves all PE lanes with one read.
+ */
+template<unsigned NF, unsigned PE, unsigned NumTH, 
+	 typename TA, typename TR, int ActVal = 0, typename Compare = comp::less<TA, TA>, unsigned BANKS = 2>
+class RuntimeThresholdsActivation {
+public:
+  ap_uint<PE*NumTH*TA::width> const (&m_thresholds)[BANKS][NF];
+  unsigned const  m_bank;
+
+public:
+  RuntimeThresholdsActivation(ap_uint<PE*NumTH*TA::width> const (&thresholds)[BANKS][NF], unsigned const  bank)
+    : m_thresholds(thresholds), m_bank(bank) {
+#pragma HLS inline
+  }
+
+public:
+  TA init(__attribute__((unused)) unsigned const  nf, __attribute__((unused)) unsigned const  pe) const {
+#pragma HLS inline
+    return  TA(0);
+  }
+
+public:
+  TR activate(unsigned const  nf, unsigned const  pe,  TA const &accu) const {
+#pragma HLS inline
+    TR result=ActVal;
+	for(unsigned int i=0; i< NumTH; i++){
+#pragma HLS unroll
+      ap_int<TA::width> const  local_temp = m_thresholds[m_bank][nf]((pe*NumTH+i+1)*TA::width-1, (pe*NumTH+i)*TA::width);
+      result+=Compare()(TA(local_temp), accu);
+    }
+    return result;
+  }
+};
+
+/*!
+ * Use a per-row threshold comparison implemented as a binary search.
+ *
+ * Drop-in replacement for ThresholdsActivation with the same parameter
+ * layout. The thresholds of every row must be sorted in ascending order.
+ * Instead of comparing the accumulator against all NumTH thresholds in
+ * parallel, the number of passed thresholds is determined by clog2(NumTH+1)
+ * successive comparisons, each against a multiplexed threshold. The result
+ * of every step but the last is registered, so that a step, i.e. one threshold
+ * multiplexer and one comparator, spans a pipeline stage. This trades
+ * clog2(NumTH+1)-1 pipeline stages for a logarithmic number of comparators.
+ *
+ * The default comparison returns true if the threshold value defined for
+ * the indexed row is smaller than the passed accumulator value.
+ */
+template<unsigned NF, unsigned PE, unsigned NumTH, 
+	 typename TA, typename TR, int ActVal = 0, typename Compare = comp::less<TA, TA>>
+class BinarySearchThresholdsActivation {
+public:
+  TA m_thresholds[PE][NF][NumTH];
+  
+public:
+  TA init(__attribute__((unused)) unsigned const  nf, __attribute__((unused)) unsigned const  pe) const {
+#pragma HLS inline
+    return  TA(0);
+  }
+
+public:
+  TR activate(unsigned const  nf, unsigned const  pe,  TA const &accu) const {
+#pragma HLS inline
+    // invariant: the first idx thresholds are passed
+    ap_uint<clog2(NumTH+1)>  idx = 0;
+    for(unsigned  s = clog2(NumTH+1); s-- > 0;) {
+#pragma HLS unroll
+      unsigned const  probe = idx + (1u << s);
+      if((probe <= NumTH) && Compare()(m_thresholds[pe][nf][probe-1], accu)) {
+        idx = probe;
+      }
+      if(s > 0)  idx = pipeline_reg(idx);
+    }
+    TR result=ActVal;
+    result+=idx;
+    return result;
+  }
+};
+
 /*!
  * \brief Use a simple activation function with per-row parameters.
  *
@@ -384,4 +487,110 @@ void Thresholding_Stream_Batch(hls::stream<TI> &in,
   }
 }
 
+/*!
+ * \brief Thresholding function for multiple images, with streaming thresholds cached on chip
+ *
+ * The function performs thresholds comparison with input activation vector, 
+ * and generating output based on the comparison results.
+ * In contrast to Thresholding_Stream_Batch, the thresholds are not streamed for
+ * every pixel. The NF words holding the thresholds of all channels are read during
+ * the first pixel of an image, stored in on-chip memory and reused for the remaining
+ * ImgDim-1 pixels. Depending on reload, the threshold stream must provide a new set of
+ * NF words for every image or a single set for the whole batch.
+ *
+ * \tparam ImgDim         Total spatial size of input feature map
+ * \tparam NumChannels    Number of channels in input feature map
+ * \tparam PE             Number of output rows computed in parallel
+ * \tparam TSrcI          DataType of the input activation (as used in the MAC)
+ * \tparam TDstI          DataType of the output activation (as generated by the activation)
+ * \tparam ActVal         Initial value of activation at start of thresholding procedure
+ * \tparam TT             DataType of the thresholds stream
+ * \tparam NumSteps       Number of thresholds per activation
+ * \tparam TI             DataType of the input stream - safely deducible from the paramaters
+ * \tparam TO             DataType of the output stream - safely deducible from the paramaters
+ *
+ * \param in              Input stream
+ * \param out             Output stream
+ * \param weight          Weight stream
+ * \param reps            Number of time the function has to be repeatedly executed (e.g. number of images)
+ * \param reload          Read new thresholds for every image (true) or only once per call (false)
+ */
+template <
+    unsigned ImgDim, unsigned NumChannels, unsigned PE,
+    typename TSrcI = Identity, typename TDstI = Identity,
+    int ActVal=0, typename TT, unsigned int NumSteps,
+    typename TI, typename TO>
+void Thresholding_Stream_Cached_Batch(hls::stream<TI> &in,
+                        hls::stream<TO> &out,
+                        hls::stream<ap_uint<PE*NumSteps*TT::width>> &weight,
+                        int const reps,
+                        bool const reload = true)
+{
+
+  // how many different rows each neuron will compute
+  // alternatively: number of vertical matrix chunks
+  constexpr unsigned  NF = NumChannels / PE;
+
+  // thresholds cache, one memory per PE
+  ap_uint<NumSteps*TT::width>  cache[PE][NF];
+#pragma HLS ARRAY_PARTITION variable=cache complete dim=1
+
+  ThresholdsActivation<1, PE, NumSteps, TT, TO, ActVal, comp::less_equal<TT, TT>> internal_thr;
+#pragma HLS ARRAY_PARTITION variable=internal_thr.m_thresholds complete dim=0
+
+  unsigned  nf  = 0;
+  unsigned  px  = 0;
+  bool      fill = true; // thresholds of the current pixel are read from the stream
+  // everything merged into a common iteration space (one "big" loop instead
+  // of smaller nested loops) to get the pipelinening the way we want
+  for (unsigned i = 0; i < reps * ImgDim * NF; i++)
+  {
+#pragma HLS pipeline style=flp II=1
+
+    ap_uint<PE*NumSteps*TT::width> packed_thr;
+    if(fill) {
+      packed_thr = weight.read();
+    }
+    // slicer to get 1 PE's worth of thresholds
+    auto const pe_slicer = Slice<ap_uint<NumSteps*TT::width>>()(packed_thr);
+
+    TI inElem;
+    inElem = in.read();
+    auto outElem = TDstI().template operator()<TO>();
+
+    for (unsigned pe = 0; pe < PE; pe++)
+    {
+#pragma HLS UNROLL
+      ap_uint<NumSteps*TT::width>  pe_thr;
+      if(fill) {
+        pe_thr = pe_slicer(pe, 0);
+        cache[pe][nf] = pe_thr;
+      }
+      else {
+        pe_thr = cache[pe][nf];
+      }
+      // slicer to get individual thresholds
+      auto const thr_slicer = Slice<TT>()(pe_thr);
+      for (unsigned nt = 0; nt < NumSteps; nt++)
+      {
+#pragma HLS UNROLL
+        internal_thr.m_thresholds[pe][0][nt] = thr_slicer(nt, 0);
+      }
+
+      auto const act = TSrcI()(inElem);
+      outElem(pe,0,1) = internal_thr.activate(0, pe, act(pe,0));
+    }
+    out.write(outElem);
+
+    if(++nf == NF) {
+      nf = 0;
+      fill = false;
+      if(++px == ImgDim) {
+        px = 0;
+        fill = reload;
+      }
+    }
+  }
+}
+
 #endif
@@ -50,6 +50,7 @@
 #include <string>
 
 #include "weights.hpp"
+#include "costmodel.hpp"
 #include "mmv.hpp"			   
 #include "streamtools.h"
 #include "dma.h"
@@ -58,3 +59,4 @@
 #include "convlayer.h"
 #include "vvau.hpp"
 #include "upsample.hpp"
+#include "softmax.hpp"
@@ -55,7 +55,9 @@
 #include "streamtools.h"
 #include "slidingwindow.h"
 #include "mvau.hpp"
+#include "vvau.hpp"
 #include "tmrcheck.hpp"
+#include "upsample.hpp"
 
 /**
  * \brief 	Convolutional layer implementation
@@ -308,4 +310,193 @@ void ConvLayer_Batch_MMV(hls::stream<ap_uint<InStreamW>>  &in,
   
 }
 
+/**
+ * \brief 	Transposed convolutional layer implementation
+ *
+ * The function implements a transposed convolutional (deconvolution) layer without multiplying the zeros a
+ * stride-expanded input would contain. It is composed of ConvolutionInputGenerator_Transposed, the
+ * Matrix_Vector_Activate_Batch function computing all Stride x Stride output phases of every window with the
+ * phase-decomposed weights documented in ConvolutionInputGenerator_Transposed, and a DepthToSpace producing the
+ * output feature map with the Padding of the transposed convolution removed. A ConvKernelDim that is not a
+ * multiple of STRIDE (e.g. 3x3 with stride 2) is zero padded to ceil(ConvKernelDim/STRIDE) taps per phase, and
+ * the rows and columns only computed by the padded taps are dropped with the Padding.
+ *
+ * \tparam ConvKernelDim 	Dimension of the convolutional kernel (assumed square)
+ * \tparam IFMChannels 		Number of Input Feature Maps
+ * \tparam IFMDim 			Width and Height of the Input Feature Map (assumed square)
+ * \tparam OFMChannels 		Number of Output Feature Maps
+ * \tparam OFMDim 			Width and Height of the Output Feature Map (assumed square), (IFMDim-1)*STRIDE + ConvKernelDim - 2*Padding
+ * \tparam STRIDE 			Stride of the transposed convolution
+ *
+ * \tparam SIMD 			Number of input columns computed in parallel
+ * \tparam PE 				Number of output rows computed in parallel
+ *
+ * \tparam TSrcI 			DataType of the input activation (as used in the MAC)
+ * \tparam TDstI 			DataType of the output activation (as generated by the activation)
+ * \tparam TWeightI 		DataType of the weights (as used in the MAC)
+ * \tparam InStreamW 		Width of the input stream
+ * \tparam OutStreamW 		Width of the output stream
+ * \tparam TW 				DataType of the weights matrix - safely deducible from the paramaters
+ * \tparam TA 				DataType of the activation class (e.g. thresholds) - safely deducible from the paramaters
+ * \tparam R 				DataType for the resource used for FPGA implementation of the MAC  - safely deducible from the paramaters
+ *
+ * \param in 				Input stream
+ * \param out 				Output stream
+ * \param weights 			Phase-decomposed weights matrix (currently supports BinaryWeights or FixedPointWeights)
+ * \param activation 		Activation class
+ * \param reps 				Number of time the function has to be repeatedly executed (e.g. number of images)
+ * \param r 				Resource type for the hardware implementation of the MAC block
+ */
+template<
+		unsigned int ConvKernelDim,
+		unsigned int IFMChannels,
+		unsigned int IFMDim,
+		unsigned int OFMChannels,
+		unsigned int OFMDim,
+		unsigned int STRIDE,
+
+		unsigned int SIMD,				// number of SIMD lanes
+		unsigned int PE,				// number of PEs
+
+		typename TSrcI = Identity,      // redefine I/O interpretation as needed for input activations
+		typename TDstI = Identity,		// redefine I/O interpretation as needed for output activations
+		typename TWeightI = Identity,	// redefine I/O interpretation as needed for weigths
+
+		int InStreamW, int OutStreamW,  // safely deducible (stream width must be int though!)
+		typename TW,   typename TA,  typename R
+>
+void ConvTransposedLayer_Batch(hls::stream<ap_uint<InStreamW>>  &in,
+			    hls::stream<ap_uint<OutStreamW>> &out,
+			    TW const        &weights,
+			    TA const        &activation,
+			    unsigned const   reps,
+				R const &r) {
+#pragma HLS INLINE
+  unsigned const Taps = (ConvKernelDim + STRIDE - 1) / STRIDE;
+  unsigned const WindowDim = IFMDim + Taps - 1;
+  // the padded taps add Taps*STRIDE - ConvKernelDim zero rows and columns behind the full output
+  unsigned const FullDim = (IFMDim - 1) * STRIDE + ConvKernelDim;
+  static_assert((FullDim >= OFMDim) && ((FullDim - OFMDim) % 2 == 0), "");
+  unsigned const Padding = (FullDim - OFMDim) / 2;
+  unsigned const PaddingBehind = Padding + Taps * STRIDE - ConvKernelDim;
+  unsigned const MatrixW = Taps * Taps * IFMChannels;
+  unsigned const MatrixH = STRIDE * STRIDE * OFMChannels;
+  unsigned const InpPerImage = IFMDim * IFMDim * IFMChannels * TSrcI::width / InStreamW;
+  hls::stream<ap_uint<SIMD*TSrcI::width> > wa_in("StreamingConvTransposedLayer_Batch.wa_in");
+  hls::stream<ap_uint<SIMD*TSrcI::width> > convInp("StreamingConvTransposedLayer_Batch.convInp");
+  hls::stream<ap_uint<PE*TDstI::width> > mvOut("StreamingConvTransposedLayer_Batch.mvOut");
+  hls::stream<ap_uint<OFMChannels*TDstI::width> > phases("StreamingConvTransposedLayer_Batch.phases");
+  hls::stream<ap_uint<OFMChannels*TDstI::width> > pixels("StreamingConvTransposedLayer_Batch.pixels");
+  StreamingDataWidthConverter_Batch<InStreamW, SIMD*TSrcI::width, InpPerImage>(in, wa_in, reps);
+  ConvolutionInputGenerator_Transposed<ConvKernelDim, IFMChannels, TSrcI::width, IFMDim,
+			SIMD, STRIDE>(wa_in, convInp, reps, ap_resource_dflt());
+  Matrix_Vector_Activate_Batch<MatrixW, MatrixH, SIMD, PE, 1, TSrcI, TDstI, TWeightI>
+    (static_cast<hls::stream<ap_uint<SIMD*TSrcI::width>>&>(convInp),
+     static_cast<hls::stream<ap_uint<PE*TDstI::width>>&>  (mvOut),
+     weights, activation, reps * WindowDim * WindowDim, r);
+  StreamingDataWidthConverter_Batch<PE*TDstI::width, OFMChannels*TDstI::width, WindowDim * WindowDim * (MatrixH / PE)>(mvOut, phases, reps);
+  DepthToSpace_Batch<WindowDim, STRIDE, OFMChannels, Padding, TDstI, PaddingBehind>(phases, pixels, reps);
+  StreamingDataWidthConverter_Batch<OFMChannels*TDstI::width, OutStreamW, OFMDim * OFMDim>(pixels, out, reps);
+
+}
+
+/**
+ * \brief   Depthwise separable convolutional layer implementation
+ *
+ * The function implements a depthwise separable convolution block (e.g. MobileNet), composed of the sliding window
+ * generator in depthwise order, the Vector_Vector_Activate_Batch for the depthwise convolution and the
+ * Matrix_Vector_Activate_Batch for the pointwise (1x1) convolution. Depthwise PE and pointwise SIMD are matched,
+ * so the depthwise output feeds the pointwise unit without any width conversion, through a FIFO holding at
+ * least the input vectors of two pixels.
+ *
+ * \tparam ConvKernelDim 	Dimension of the depthwise convolutional kernel (assumed square)
+ * \tparam IFMChannels 		Number of Input Feature Maps
+ * \tparam IFMDim 			Width and Height of the Input Feature Map (assumed square)
+ * \tparam OFMChannels 		Number of Output Feature Maps
+ * \tparam OFMDim 			Width and Height of the Output Feature Map (assumed square)
+ * \tparam STRIDE 			Stride of the depthwise convolution
+ *
+ * \tparam SIMD 			Number of channels computed in parallel by the depthwise unit and of input columns
+ *							computed in parallel by the pointwise unit
+ * \tparam PE 				Number of output rows computed in parallel by the pointwise unit
+ *
+ * \tparam TSrcI 			DataType of the input activation (as used in the depthwise MAC)
+ * \tparam TMidI 			DataType of the depthwise output activation (as generated by the depthwise activation and used in the pointwise MAC)
+ * \tparam TDstI 			DataType of the output activation (as generated by the pointwise activation)
+ * \tparam TWeightDwI 		DataType of the depthwise weights (as used in the MAC)
+ * \tparam TWeightPwI 		DataType of the pointwise weights (as used in the MAC)
+ * \tparam InStreamW 		Width of the input stream
+ * \tparam OutStreamW 		Width of the output stream
+ * \tparam TWD 				DataType of the depthwise weights matrix - safely deducible from the paramaters
+ * \tparam TAD 				DataType of the depthwise activation class (e.g. thresholds) - safely deducible from the paramaters
+ * \tparam TWP 				DataType of the pointwise weights matrix - safely deducible from the paramaters
+ * \tparam TAP 				DataType of the pointwise activation class (e.g. thresholds) - safely deducible from the paramaters
+ * \tparam R 				DataType for the resource used for FPGA implementation of the MAC  - safely deducible from the paramaters
+ *
+ * \param in 				Input stream
+ * \param out 				Output stream
+ * \param dw_weights 		Depthwise weights, one kernel tap per tile (currently supports FixedPointWeights with SIMD = 1)
+ * \param dw_activation 	Depthwise activation class
+ * \param pw_weights 		Pointwise weights matrix (currently supports BinaryWeights or FixedPointWeights)
+ * \param pw_activation 	Pointwise activation class
+ * \param reps 				Number of time the function has to be repeatedly executed (e.g. number of images)
+ * \param r 				Resource type for the hardware implementation of the MAC blocks
+ */
+template<
+		unsigned int ConvKernelDim,
+		unsigned int IFMChannels,
+		unsigned int IFMDim,
+		unsigned int OFMChannels,
+		unsigned int OFMDim,
+		unsigned int STRIDE,
+
+		unsigned int SIMD,				// number of depthwise PEs and pointwise SIMD lanes
+		unsigned int PE,				// number of pointwise PEs
+
+		typename TSrcI = Identity,      // redefine I/O interpretation as needed for input activations
+		typename TMidI = Identity,      // redefine I/O interpretation as needed for depthwise output activations
+		typename TDstI = Identity,		// redefine I/O interpretation as needed for output activations
+		typename TWeightDwI = Identity,	// redefine I/O interpretation as needed for depthwise weigths
+		typename TWeightPwI = Identity,	// redefine I/O interpretation as needed for pointwise weigths
+
+		int InStreamW, int OutStreamW,  // safely deducible (stream width must be int though!)
+		typename TWD,  typename TAD,
+		typename TWP,  typename TAP,  typename R
+>
+void DepthwiseSeparableLayer_Batch(hls::stream<ap_uint<InStreamW>>  &in,
+			    hls::stream<ap_uint<OutStreamW>> &out,
+			    TWD const        &dw_weights,
+			    TAD const        &dw_activation,
+			    TWP const        &pw_weights,
+			    TAP const        &pw_activation,
+			    unsigned const   reps,
+				R const &r) {
+#pragma HLS INLINE
+  unsigned const InpPerImage = IFMDim * IFMDim * IFMChannels * TSrcI::width / InStreamW;
+  // the pointwise unit reads the SF = IFMChannels/SIMD words of a pixel during its first output fold and
+  // computes the remaining NF - 1 = OFMChannels/PE - 1 folds without reading, the FIFO takes the backlog
+  // its cost model predicts so that the depthwise unit keeps producing meanwhile
+  typedef cost::Matrix_Vector_Activate_Batch<IFMChannels, OFMChannels, SIMD, PE, 1, cost::weight_bits<TWP>::value,
+                                             TMidI::width, 0, OFMDim * OFMDim>  PointwiseCost;
+  constexpr unsigned MidDepth __attribute__((unused)) = PointwiseCost::ideal_fifo_depth;
+  hls::stream<ap_uint<SIMD*TSrcI::width> > wa_in("StreamingDepthwiseSeparableLayer_Batch.wa_in");
+  hls::stream<ap_uint<SIMD*TSrcI::width> > convInp("StreamingDepthwiseSeparableLayer_Batch.convInp");
+  hls::stream<ap_uint<SIMD*TMidI::width> > dwOut("StreamingDepthwiseSeparableLayer_Batch.dwOut");
+#pragma HLS STREAM variable=dwOut depth=MidDepth
+  hls::stream<ap_uint<PE*TDstI::width> > mvOut("StreamingDepthwiseSeparableLayer_Batch.mvOut");
+  StreamingDataWidthConverter_Batch<InStreamW, SIMD*TSrcI::width, InpPerImage>(in, wa_in, reps);
+  ConvolutionInputGenerator_generic<ConvKernelDim, IFMChannels, TSrcI::width, IFMDim,
+			OFMDim, SIMD, STRIDE, 1, 1, true>(wa_in, convInp, reps, ap_resource_dflt());
+  Vector_Vector_Activate_Batch<IFMChannels, ConvKernelDim * ConvKernelDim, 1, SIMD, 1, TSrcI, TMidI, TWeightDwI>
+    (static_cast<hls::stream<ap_uint<SIMD*TSrcI::width>>&>(convInp),
+     static_cast<hls::stream<ap_uint<SIMD*TMidI::width>>&>  (dwOut),
+     dw_weights, dw_activation, reps * OFMDim * OFMDim, r);
+  Matrix_Vector_Activate_Batch<IFMChannels, OFMChannels, SIMD, PE, 1, TMidI, TDstI, TWeightPwI>
+    (static_cast<hls::stream<ap_uint<SIMD*TMidI::width>>&>(dwOut),
+     static_cast<hls::stream<ap_uint<PE*TDstI::width>>&>  (mvOut),
+     pw_weights, pw_activation, reps * OFMDim * OFMDim, r);
+  StreamingDataWidthConverter_Batch<PE*TDstI::width, OutStreamW, OFMDim * OFMDim * (OFMChannels / PE)>(mvOut, out, reps);
+
+}
+
 #endif
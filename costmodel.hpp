@@ -0,0 +1,669 @@
+/******************************************************************************
+ *  Copyright (c) 2026, Advanced Micro Devices, Inc.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *
+ *  1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *
+ *  2.  Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ *  3.  Neither the name of the copyright holder nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION). HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ *  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************/
+/******************************************************************************
+ *
+ *  \file costmodel.hpp
+ *
+ *  Library of templated HLS functions for BNN deployment.
+ *  This file provides a compile-time cycle and memory cost model of the
+ *  sliding window generators, matrix/vector-vector activate units and
+ *  max pool kernels. Every cost class takes the template parameters of the
+ *  kernel it describes and exposes:
+ *   - cycles_per_image:     iterations of the pipelined loop for one image
+ *   - initiation_interval:  initiation interval of the pipelined loop
+ *   - buffer_bits:          bits of the on-chip buffers (line buffers, weights and thresholds)
+ *   - ideal_fifo_depth:     depth of the input FIFO that lets a producer writing
+ *                           one word per cycle stream a whole image without stalling
+ *  The kernels static_assert the cost entries against values derived from their
+ *  declared buffers and their I/O (or, for the MVAU and VVAU, their MAC count).
+ *
+ *  Covered are the sliding window generators of slidingwindow.h, the MVAU,
+ *  VVAU, max pool, global pooling and softmax kernels. The cost of
+ *  ConvolutionInputGenerator_dynamic is a function of its runtime
+ *  configuration. The cycles of the _generic, _3D and _lowmem generators
+ *  depend on how their decoupled read and write sides stall each other and
+ *  are bounded from above.
+ *  Thresholding, stream tools and the remaining layers are not modelled.
+ *
+ *****************************************************************************/
+
+#ifndef COSTMODEL_HPP
+#define COSTMODEL_HPP
+
+#include <type_traits>
+#include "utils.hpp"
+
+template <unsigned int NumChannels, unsigned int DataWidth>
+class MultiChanData;
+
+/**
+ * Counting of the pipelined loop iterations of the instrumented kernels in C
+ * simulation is enabled by defining FINN_HLSLIB_COUNT_ITERATIONS to 1 in the
+ * top function and in the testbench. Every image processed by a kernel appends
+ * an entry to cost::iteration_log(), so that a testbench can compare it with
+ * cycles_per_image. The hooks expand to nothing in synthesis.
+ */
+#ifndef FINN_HLSLIB_COUNT_ITERATIONS
+#define FINN_HLSLIB_COUNT_ITERATIONS 0
+#endif
+
+#if FINN_HLSLIB_COUNT_ITERATIONS && !defined(__SYNTHESIS__)
+#include <vector>
+namespace cost {
+inline std::vector<unsigned long long> &iteration_log() {
+  static std::vector<unsigned long long>  log;
+  return  log;
+}
+}
+#define FINN_HLSLIB_COUNT_IMAGE()     cost::iteration_log().push_back(0)
+#define FINN_HLSLIB_COUNT_ITERATION() cost::iteration_log().back()++
+#else
+#define FINN_HLSLIB_COUNT_IMAGE()
+#define FINN_HLSLIB_COUNT_ITERATION()
+#endif
+
+namespace cost {
+
+/**
+ * \brief Compile-time maximum
+ */
+constexpr unsigned long long cmax(unsigned long long const  a, unsigned long long const  b) {
+  return  a > b? a : b;
+}
+
+/**
+ * \brief Compile-time difference, saturated at zero
+ */
+constexpr unsigned long long csub(unsigned long long const  a, unsigned long long const  b) {
+  return  a > b? a - b : 0;
+}
+
+/**
+ * \brief Bits of a stream or buffer element of a kernel
+ */
+template<typename T>
+struct element_bits {
+  static constexpr unsigned long long  value = T::width;
+};
+template<unsigned int NumChannels, unsigned int DataWidth>
+struct element_bits<MultiChanData<NumChannels, DataWidth>> {
+  static constexpr unsigned long long  value = NumChannels * DataWidth + 0ull;
+};
+
+/**
+ * \brief Bits per weight stored by a weight container, as declared by its WEIGHT_BITS, 0 for
+ * containers that do not declare it
+ */
+template<typename TW, typename = void>
+struct weight_bits {
+  static constexpr unsigned long long  value = 0;
+};
+template<typename TW>
+struct weight_bits<TW, typename std::enable_if<(TW::WEIGHT_BITS > 0)>::type> {
+  static constexpr unsigned long long  value = TW::WEIGHT_BITS;
+};
+
+/**
+ * \brief Input words a producer writing one word per cycle is ahead of a kernel when it has written a whole image
+ *
+ * The kernel reads InitialReads words in the first cycles, then BlockReads words at the beginning of every
+ * block of BlockCycles cycles.
+ */
+constexpr unsigned long long input_backlog(unsigned long long const  total_reads, unsigned long long const  initial_reads,
+                                           unsigned long long const  block_reads, unsigned long long const  block_cycles) {
+  return  (total_reads <= initial_reads) || (block_reads >= block_cycles)? 0 :
+    total_reads - initial_reads - (total_reads - initial_reads) / block_cycles * block_reads
+      - ((total_reads - initial_reads) % block_cycles < block_reads? (total_reads - initial_reads) % block_cycles : block_reads);
+}
+
+/**
+ * \brief Common cost fields of the pipelined kernels, see input_backlog for the read pattern
+ */
+template<unsigned long long Cycles, unsigned long long Bits, unsigned long long TotalReads,
+         unsigned long long InitialReads, unsigned long long BlockReads, unsigned long long BlockCycles>
+struct Cost {
+  static constexpr unsigned long long  cycles_per_image = Cycles;
+  static constexpr unsigned  initiation_interval = 1;
+  static constexpr unsigned long long  buffer_bits = Bits;
+  // a backlog-free stream still needs a double-buffered FIFO
+  static constexpr unsigned long long  ideal_fifo_depth = cmax(2, input_backlog(TotalReads, InitialReads, BlockReads, BlockCycles));
+};
+
+/**
+ * \brief Line-buffered sliding window generators reading an initial block of lines and then Stride lines
+ * per output row, while producing the windows of the current row
+ */
+template<unsigned long long InitialReads, unsigned long long CyclesWriteBlock, unsigned long long CyclesReadBlock,
+         unsigned long long OutputRows, unsigned long long TotalReads, unsigned long long Bits>
+struct SlidingWindowCost : public Cost<InitialReads + OutputRows * cmax(CyclesWriteBlock, CyclesReadBlock),
+    Bits, TotalReads, InitialReads, CyclesReadBlock, cmax(CyclesWriteBlock, CyclesReadBlock)> {};
+
+/**
+ * \brief Cost of ConvolutionInputGenerator
+ */
+template<unsigned int ConvKernelDim, unsigned int IFMChannels, unsigned int Input_precision, unsigned int IFMDim,
+         unsigned int OFMDim, unsigned int SIMD, unsigned int Stride>
+struct ConvolutionInputGenerator : public SlidingWindowCost<
+    IFMDim * ConvKernelDim * (IFMChannels/SIMD),
+    OFMDim * ConvKernelDim * ConvKernelDim * (IFMChannels/SIMD),
+    Stride * IFMDim * (IFMChannels/SIMD),
+    OFMDim, IFMDim * IFMDim * (IFMChannels/SIMD),
+    (ConvKernelDim/Stride + 1ull) * Stride * IFMDim * IFMChannels * Input_precision> {};
+
+/**
+ * \brief Words of the circular buffer of ConvolutionInputGenerator_lowmem
+ *
+ * The buffer spans a window, or the lines the write side must be ahead of the windows at the end of an output
+ * row so that the next row does not wait for its last line, less the words written while its first window reads
+ * the lines before and while the read side waits on an output row shorter than the input lines it consumes.
+ * Two words are in flight between the write and the read side, and up to two packed buffer words are
+ * assembled or pending, which also rounds the buffer up to whole packed words.
+ */
+constexpr unsigned long long lowmem_buffer_words(unsigned long long const  kernel, unsigned long long const  stride,
+                                                 unsigned long long const  line, unsigned long long const  group,
+                                                 unsigned long long const  out_dim, unsigned long long const  packed) {
+  return  (cmax((kernel - 1) * line + kernel * group,
+                csub((stride + kernel - 1) * line + kernel * group,
+                     (out_dim - 1) * stride * group + (kernel - 1) * kernel * group +
+                     csub(stride * line, out_dim * kernel * kernel * group)))
+           + 3 * packed - 1) / packed * packed;
+}
+
+/**
+ * \brief Cost of ConvolutionInputGenerator_lowmem, an upper bound of the cycles in which the whole first window
+ * is read upfront and the write side runs ahead by the lines of the next output row, see lowmem_buffer_words
+ */
+template<unsigned int ConvKernelDim, unsigned int IFMChannels, unsigned int Input_precision, unsigned int IFMDim,
+         unsigned int OFMDim, unsigned int SIMD, unsigned int Stride, unsigned int PackedGroups = 1>
+struct ConvolutionInputGenerator_lowmem : public SlidingWindowCost<
+    ((ConvKernelDim - 1) * IFMDim + ConvKernelDim) * (IFMChannels/SIMD) + 2 * PackedGroups,
+    OFMDim * ConvKernelDim * ConvKernelDim * (IFMChannels/SIMD),
+    Stride * IFMDim * (IFMChannels/SIMD),
+    OFMDim, IFMDim * IFMDim * (IFMChannels/SIMD),
+    lowmem_buffer_words(ConvKernelDim, Stride, IFMDim * (IFMChannels/SIMD), IFMChannels/SIMD, OFMDim, PackedGroups)
+      * SIMD * Input_precision> {};
+
+/**
+ * \brief Cost of ConvolutionInputGenerator_dynamic, whose buffer is sized by the compile-time maxima while
+ * the cycles and the FIFO depth are functions of the runtime configuration
+ */
+template<unsigned int MaxConvKernelDim, unsigned int MaxIFMChannels, unsigned int Input_precision,
+         unsigned int MaxIFMDim, unsigned int SIMD, unsigned int MaxStride>
+struct ConvolutionInputGenerator_dynamic {
+  static constexpr unsigned  initiation_interval = 1;
+  static constexpr unsigned long long  buffer_bits =
+    (MaxConvKernelDim + MaxStride + 0ull) * MaxIFMDim * MaxIFMChannels * Input_precision;
+
+  static constexpr unsigned long long cycles_per_image(unsigned int const  ConvKernelDim, unsigned int const  IFMChannels,
+                                                       unsigned int const  IFMDim, unsigned int const  OFMDim,
+                                                       unsigned int const  Stride) {
+    return  (ConvKernelDim + 0ull) * IFMDim * (IFMChannels/SIMD) +
+      OFMDim * cmax((OFMDim + 0ull) * ConvKernelDim * ConvKernelDim * (IFMChannels/SIMD),
+                    (Stride + 0ull) * IFMDim * (IFMChannels/SIMD));
+  }
+  static constexpr unsigned long long ideal_fifo_depth(unsigned int const  ConvKernelDim, unsigned int const  IFMChannels,
+                                                       unsigned int const  IFMDim, unsigned int const  OFMDim,
+                                                       unsigned int const  Stride) {
+    return  cmax(2, input_backlog((IFMDim + 0ull) * IFMDim * (IFMChannels/SIMD),
+                                  (ConvKernelDim + 0ull) * IFMDim * (IFMChannels/SIMD),
+                                  (Stride + 0ull) * IFMDim * (IFMChannels/SIMD),
+                                  cmax((OFMDim + 0ull) * ConvKernelDim * ConvKernelDim * (IFMChannels/SIMD),
+                                       (Stride + 0ull) * IFMDim * (IFMChannels/SIMD))));
+  }
+};
+
+/**
+ * \brief Upper bound of the iterations of the generators with decoupled read and write sides
+ *
+ * Every iteration reads an input word, produces an output word or waits for the word written in the
+ * iteration before while the write side is stalled. A write side stalled by the window stays stalled
+ * until the window moves, so the latter happens at most once per output window (group of MMV pixels)
+ * and once after the last input word.
+ */
+constexpr unsigned long long decoupled_cycles(unsigned long long const  reads, unsigned long long const  outputs,
+                                              unsigned long long const  windows) {
+  return  reads + outputs + windows + 1;
+}
+
+/**
+ * \brief Cost of ConvolutionInputGenerator_generic, an upper bound of the cycles, see decoupled_cycles;
+ * the FIFO depth is the one of a line buffer holding the rows of a window
+ */
+template<unsigned int ConvKernelDim, unsigned int IFMChannels, unsigned int Input_precision, unsigned int IFMDim,
+         unsigned int OFMDim, unsigned int SIMD, unsigned int Stride, unsigned int Dilation, unsigned int MMV>
+struct ConvolutionInputGenerator_generic : public Cost<
+    decoupled_cycles(IFMDim * IFMDim * (IFMChannels/SIMD + 0ull),
+                     OFMDim * OFMDim * ConvKernelDim * ConvKernelDim * (IFMChannels/SIMD + 0ull) / MMV,
+                     OFMDim * OFMDim / MMV),
+    MMV * ((ConvKernelDim - 1ull) * Dilation + 1) * IFMDim * IFMChannels * Input_precision,
+    IFMDim * IFMDim * (IFMChannels/SIMD + 0ull),
+    ((ConvKernelDim - 1ull) * Dilation * IFMDim + (ConvKernelDim - 1) * Dilation + 1 + (MMV - 1) * Stride) * (IFMChannels/SIMD),
+    Stride * IFMDim * (IFMChannels/SIMD + 0ull),
+    cmax(OFMDim * ConvKernelDim * ConvKernelDim * (IFMChannels/SIMD + 0ull) / MMV, Stride * IFMDim * (IFMChannels/SIMD + 0ull))> {};
+
+/**
+ * \brief Cost of ConvolutionInputGenerator_3D, an upper bound of the cycles, see decoupled_cycles;
+ * the FIFO depth is the one of a frame buffer holding the frames of a window
+ */
+template<unsigned int ConvKernelDim_t, unsigned int ConvKernelDim, unsigned int IFMChannels, unsigned int Input_precision,
+         unsigned int IFMDepth, unsigned int IFMDim, unsigned int OFMDepth, unsigned int OFMDim, unsigned int SIMD,
+         unsigned int Stride_t, unsigned int Stride, unsigned int Dilation_t, unsigned int Dilation>
+struct ConvolutionInputGenerator_3D : public Cost<
+    decoupled_cycles(IFMDepth * IFMDim * IFMDim * (IFMChannels/SIMD + 0ull),
+                     OFMDepth * OFMDim * OFMDim * ConvKernelDim_t * ConvKernelDim * ConvKernelDim * (IFMChannels/SIMD + 0ull),
+                     OFMDepth * OFMDim * (OFMDim + 0ull)),
+    ((ConvKernelDim_t - 1ull) * Dilation_t + 1) * IFMDim * IFMDim * IFMChannels * Input_precision,
+    IFMDepth * IFMDim * IFMDim * (IFMChannels/SIMD + 0ull),
+    ((ConvKernelDim_t - 1ull) * Dilation_t * IFMDim * IFMDim +
+     ((ConvKernelDim - 1ull) * Dilation * IFMDim + (ConvKernelDim - 1) * Dilation + 1)) * (IFMChannels/SIMD),
+    Stride_t * IFMDim * IFMDim * (IFMChannels/SIMD + 0ull),
+    cmax(OFMDim * OFMDim * ConvKernelDim_t * ConvKernelDim * ConvKernelDim * (IFMChannels/SIMD + 0ull),
+         Stride_t * IFMDim * IFMDim * (IFMChannels/SIMD + 0ull))> {};
+
+/**
+ * \brief Cost of ConvolutionInputGenerator_MMV
+ */
+template<unsigned int ConvKernelDim, unsigned int IFMChannels, unsigned int Input_precision, unsigned int IFMDim,
+         unsigned int OFMDim, unsigned int SIMD, unsigned int Stride, unsigned int MMV>
+struct ConvolutionInputGenerator_MMV : public SlidingWindowCost<
+    IFMDim * ConvKernelDim * (IFMChannels/SIMD),
+    OFMDim * ConvKernelDim * ConvKernelDim * (IFMChannels/SIMD) / MMV,
+    Stride * IFMDim * (IFMChannels/SIMD),
+    OFMDim, IFMDim * IFMDim * (IFMChannels/SIMD),
+    MMV * (ConvKernelDim/Stride + 1ull) * Stride * IFMDim * IFMChannels * Input_precision> {};
+
+/**
+ * \brief Cost of ConvolutionInputGenerator_dws, TapSIMD = 1 for the variant without kernel tap parallelism
+ */
+template<unsigned int ConvKernelDim, unsigned int IFMChannels, unsigned int Input_precision, unsigned int IFMDim,
+         unsigned int OFMDim, unsigned int SIMD, unsigned int TapSIMD, unsigned int Stride>
+struct ConvolutionInputGenerator_dws : public SlidingWindowCost<
+    IFMDim * ConvKernelDim * (IFMChannels/SIMD),
+    OFMDim * ConvKernelDim * ConvKernelDim * (IFMChannels/SIMD) / TapSIMD,
+    Stride * IFMDim * (IFMChannels/SIMD),
+    OFMDim, IFMDim * IFMDim * (IFMChannels/SIMD),
+    TapSIMD * (ConvKernelDim/Stride + 1ull) * Stride * IFMDim * IFMChannels * Input_precision> {};
+
+/**
+ * \brief Cost of ConvolutionInputGenerator_dws_MMV
+ */
+template<unsigned int ConvKernelDim, unsigned int IFMChannels, unsigned int Input_precision, unsigned int IFMDim,
+         unsigned int OFMDim, unsigned int SIMD, unsigned int Stride, unsigned int MMV>
+struct ConvolutionInputGenerator_dws_MMV : public ConvolutionInputGenerator_MMV<
+    ConvKernelDim, IFMChannels, Input_precision, IFMDim, OFMDim, SIMD, Stride, MMV> {};
+
+/**
+ * \brief Cost of ConvolutionInputGenerator_kernel_stride_MMV, the last output row does not overlap with reads
+ */
+template<unsigned int ConvKernelDim, unsigned int IFMChannels, unsigned int Input_precision, unsigned int IFMDim,
+         unsigned int OFMDim, unsigned int SIMD, unsigned int Stride, unsigned int MMV>
+struct ConvolutionInputGenerator_kernel_stride_MMV : public Cost<
+    IFMDim * ConvKernelDim * (IFMChannels/SIMD)
+      + (OFMDim - 1ull) * cmax(OFMDim * ConvKernelDim * ConvKernelDim * (IFMChannels/SIMD) / MMV, Stride * IFMDim * (IFMChannels/SIMD))
+      + cmax(OFMDim * ConvKernelDim * ConvKernelDim * (IFMChannels/SIMD) / MMV, OFMDim),
+    MMV * (ConvKernelDim + Stride + 0ull) * IFMDim * IFMChannels * Input_precision,
+    IFMDim * IFMDim * (IFMChannels/SIMD), IFMDim * ConvKernelDim * (IFMChannels/SIMD),
+    Stride * IFMDim * (IFMChannels/SIMD),
+    cmax(OFMDim * ConvKernelDim * ConvKernelDim * (IFMChannels/SIMD) / MMV, Stride * IFMDim * (IFMChannels/SIMD))> {};
+
+/**
+ * \brief Cost of ConvolutionInputGenerator_kernel_stride
+ */
+template<unsigned int ConvKernelDim, unsigned int IFMChannels, unsigned int Input_precision, unsigned int IFMDim,
+         unsigned int OFMDim, unsigned int SIMD, unsigned int Stride>
+struct ConvolutionInputGenerator_kernel_stride : public ConvolutionInputGenerator_kernel_stride_MMV<
+    ConvKernelDim, IFMChannels, Input_precision, IFMDim, OFMDim, SIMD, Stride, 1> {};
+
+/**
+ * \brief Cost of ConvolutionInputGenerator_kernel_stride_dws
+ */
+template<unsigned int ConvKernelDim, unsigned int IFMChannels, unsigned int Input_precision, unsigned int IFMDim,
+         unsigned int OFMDim, unsigned int SIMD, unsigned int Stride>
+struct ConvolutionInputGenerator_kernel_stride_dws : public ConvolutionInputGenerator_kernel_stride_MMV<
+    ConvKernelDim, IFMChannels, Input_precision, IFMDim, OFMDim, SIMD, Stride, 1> {};
+
+/**
+ * \brief Cost of ConvolutionInputGenerator_NonSquare
+ */
+template<unsigned int ConvKernelDim_x, unsigned int ConvKernelDim_y, unsigned int IFMChannels, unsigned int Input_precision,
+         unsigned int IFMDim_x, unsigned int IFMDim_y, unsigned int OFMDim_x, unsigned int OFMDim_y,
+         unsigned int SIMD, unsigned int Stride_x, unsigned int Stride_y>
+struct ConvolutionInputGenerator_NonSquare : public SlidingWindowCost<
+    IFMDim_x * ConvKernelDim_y * (IFMChannels/SIMD),
+    OFMDim_x * ConvKernelDim_x * ConvKernelDim_y * (IFMChannels/SIMD),
+    Stride_x * IFMDim_x * (IFMChannels/SIMD),
+    OFMDim_y, IFMDim_x * IFMDim_y * (IFMChannels/SIMD),
+    (ConvKernelDim_y/Stride_y + 1ull) * Stride_x * IFMDim_x * IFMChannels * Input_precision> {};
+
+/**
+ * \brief Cost of ConvolutionInputGenerator_NonSquare_dws
+ */
+template<unsigned int ConvKernelDim_x, unsigned int ConvKernelDim_y, unsigned int IFMChannels, unsigned int Input_precision,
+         unsigned int IFMDim_x, unsigned int IFMDim_y, unsigned int OFMDim_x, unsigned int OFMDim_y,
+         unsigned int SIMD, unsigned int Stride_x, unsigned int Stride_y>
+struct ConvolutionInputGenerator_NonSquare_dws : public ConvolutionInputGenerator_NonSquare<
+    ConvKernelDim_x, ConvKernelDim_y, IFMChannels, Input_precision, IFMDim_x, IFMDim_y, OFMDim_x, OFMDim_y, SIMD, Stride_x, Stride_y> {};
+
+/**
+ * \brief Cost of ConvolutionInputGenerator_NonSquare_Dilated
+ */
+template<unsigned int ConvKernelDim_x, unsigned int ConvKernelDim_y, unsigned int IFMChannels, unsigned int Input_precision,
+         unsigned int IFMDim_x, unsigned int IFMDim_y, unsigned int OFMDim_x, unsigned int OFMDim_y,
+         unsigned int SIMD, unsigned int Stride_x, unsigned int Stride_y, unsigned int Dilation_x, unsigned int Dilation_y>
+struct ConvolutionInputGenerator_NonSquare_Dilated : public SlidingWindowCost<
+    IFMDim_x * ConvKernelDim_y * Dilation_y * (IFMChannels/SIMD),
+    OFMDim_x * ConvKernelDim_x * ConvKernelDim_y * (IFMChannels/SIMD),
+    Stride_x * IFMDim_x * (IFMChannels/SIMD),
+    OFMDim_y, IFMDim_x * IFMDim_y * (IFMChannels/SIMD),
+    ((ConvKernelDim_y * Dilation_y)/Stride_y + 1ull) * Stride_x * IFMDim_x * IFMChannels * Input_precision> {};
+
+/**
+ * \brief Cost of ConvolutionInputGenerator_NonSquare_Dilated_MMV
+ */
+template<unsigned int ConvKernelDim_x, unsigned int ConvKernelDim_y, unsigned int IFMChannels, unsigned int Input_precision,
+         unsigned int IFMDim_x, unsigned int IFMDim_y, unsigned int OFMDim_x, unsigned int OFMDim_y,
+         unsigned int SIMD, unsigned int Stride_x, unsigned int Stride_y, unsigned int Dilation_x, unsigned int Dilation_y,
+         unsigned int MMV>
+struct ConvolutionInputGenerator_NonSquare_Dilated_MMV : public SlidingWindowCost<
+    IFMDim_x * ConvKernelDim_y * (IFMChannels/SIMD),
+    OFMDim_x * ConvKernelDim_x * ConvKernelDim_y * (IFMChannels/SIMD) / MMV,
+    Stride_y * IFMDim_x * (IFMChannels/SIMD),
+    OFMDim_y, IFMDim_x * IFMDim_y * (IFMChannels/SIMD),
+    MMV * (ConvKernelDim_y/Stride_y + 1ull) * Stride_y * IFMDim_x * IFMChannels * Input_precision> {};
+
+/**
+ * \brief Cost of ConvolutionInputGenerator_NonSquare_MMV
+ */
+template<unsigned int ConvKernelDim_x, unsigned int ConvKernelDim_y, unsigned int IFMChannels, unsigned int Input_precision,
+         unsigned int IFMDim_x, unsigned int IFMDim_y, unsigned int OFMDim_x, unsigned int OFMDim_y,
+         unsigned int SIMD, unsigned int Stride_x, unsigned int Stride_y, unsigned int MMV>
+struct ConvolutionInputGenerator_NonSquare_MMV : public ConvolutionInputGenerator_NonSquare_Dilated_MMV<
+    ConvKernelDim_x, ConvKernelDim_y, IFMChannels, Input_precision, IFMDim_x, IFMDim_y, OFMDim_x, OFMDim_y, SIMD, Stride_x, Stride_y, 1, 1, MMV> {};
+
+/**
+ * \brief Cost of ConvolutionInputGenerator_NonSquare_dws_MMV
+ */
+template<unsigned int ConvKernelDim_x, unsigned int ConvKernelDim_y, unsigned int IFMChannels, unsigned int Input_precision,
+         unsigned int IFMDim_x, unsigned int IFMDim_y, unsigned int OFMDim_x, unsigned int OFMDim_y,
+         unsigned int SIMD, unsigned int Stride_x, unsigned int Stride_y, unsigned int MMV>
+struct ConvolutionInputGenerator_NonSquare_dws_MMV : public ConvolutionInputGenerator_NonSquare_Dilated_MMV<
+    ConvKernelDim_x, ConvKernelDim_y, IFMChannels, Input_precision, IFMDim_x, IFMDim_y, OFMDim_x, OFMDim_y, SIMD, Stride_x, Stride_y, 1, 1, MMV> {};
+
+/**
+ * \brief Cost of ConvolutionInputGenerator_padded, only the input rows of the first window are read upfront
+ */
+template<unsigned int ConvKernelDim, unsigned int IFMChannels, unsigned int Input_precision, unsigned int IFMDim,
+         unsigned int OFMDim, unsigned int SIMD, unsigned int Stride, unsigned int PaddingBefore, unsigned int PaddingBehind>
+struct ConvolutionInputGenerator_padded : public SlidingWindowCost<
+    (ConvKernelDim - PaddingBefore) * IFMDim * (IFMChannels/SIMD),
+    OFMDim * ConvKernelDim * ConvKernelDim * (IFMChannels/SIMD),
+    Stride * IFMDim * (IFMChannels/SIMD),
+    OFMDim, IFMDim * IFMDim * (IFMChannels/SIMD),
+    (ConvKernelDim + Stride + 0ull) * IFMDim * IFMChannels * Input_precision> {};
+
+/**
+ * \brief Cost of ConvolutionInputGenerator_Transposed, with ceil(ConvKernelDim/Stride) taps per phase
+ */
+template<unsigned int ConvKernelDim, unsigned int IFMChannels, unsigned int Input_precision, unsigned int IFMDim,
+         unsigned int SIMD, unsigned int Stride>
+struct ConvolutionInputGenerator_Transposed : public ConvolutionInputGenerator_padded<
+    (ConvKernelDim + Stride - 1)/Stride, IFMChannels, Input_precision, IFMDim, IFMDim + (ConvKernelDim + Stride - 1)/Stride - 1,
+    SIMD, 1, (ConvKernelDim + Stride - 1)/Stride - 1, (ConvKernelDim + Stride - 1)/Stride - 1> {};
+
+/**
+ * \brief Cost of ConvolutionInputGenerator_parallel, one input pixel per cycle
+ */
+template<unsigned int ConvKernelDim, unsigned int IFMChannels, unsigned int Input_precision, unsigned int IFMDim,
+         unsigned int OFMDim, unsigned int Stride, unsigned int SIMD>
+struct ConvolutionInputGenerator_parallel : public Cost<
+    IFMDim * IFMDim + 0ull,
+    ((ConvKernelDim > 1? ConvKernelDim - 1 : 1) * IFMDim + ConvKernelDim * ConvKernelDim + 0ull) * SIMD * Input_precision,
+    IFMDim * IFMDim, 0, 1, 1> {};
+
+/**
+ * \brief Cost of ConvolutionInputGenerator_2D_kernel1, one input pixel per iteration at II = IFMChannels/SIMD
+ */
+template<unsigned int IFMChannels, unsigned int Input_precision, unsigned int IFMDim, unsigned int SIMD, unsigned int Stride>
+struct ConvolutionInputGenerator_2D_kernel1 : public Cost<
+    IFMDim * IFMDim + 0ull, 0,
+    IFMDim * IFMDim * (IFMChannels/SIMD + 0ull), 0, 1, 1> {
+  static constexpr unsigned  initiation_interval = IFMChannels/SIMD;
+};
+
+/**
+ * \brief Cost of ConvolutionInputGenerator_1D_kernel1
+ */
+template<unsigned int IFMChannels, unsigned int Input_precision, unsigned int IFMDim, unsigned int SIMD, unsigned int Stride>
+struct ConvolutionInputGenerator_1D_kernel1 : public Cost<
+    IFMDim * (IFMChannels/SIMD + 0ull), 0,
+    IFMDim * (IFMChannels/SIMD + 0ull), 0, 1, 1> {};
+
+/**
+ * \brief Cost of ConvolutionInputGenerator_1D_parallel, ConvKernelDim initial reads and then one
+ * input pixel per output window
+ */
+template<unsigned int ConvKernelDim, unsigned int IFMChannels, unsigned int Input_precision, unsigned int IFMDim,
+         unsigned int OFMDim, unsigned int Stride, unsigned int SIMD>
+struct ConvolutionInputGenerator_1D_parallel : public Cost<
+    ConvKernelDim + OFMDim + 0ull,
+    (ConvKernelDim + 1ull) * SIMD * Input_precision,
+    IFMDim, ConvKernelDim, 1, 1> {};
+
+/**
+ * \brief Cost of ConvolutionInputGenerator_1D_dws_naive, the whole input row is read upfront
+ */
+template<unsigned int ConvKernelDim_x, unsigned int IFMChannels, unsigned int Input_precision, unsigned int IFMDim_x,
+         unsigned int OFMDim_x, unsigned int Stride_x, unsigned int Dilation_x, unsigned int SIMD>
+struct ConvolutionInputGenerator_1D_dws_naive : public Cost<
+    (IFMDim_x + OFMDim_x * ConvKernelDim_x) * (IFMChannels/SIMD + 0ull),
+    (IFMDim_x + 0ull) * IFMChannels * Input_precision,
+    IFMDim_x * (IFMChannels/SIMD + 0ull), IFMDim_x * (IFMChannels/SIMD + 0ull), 1, 1> {};
+
+/**
+ * \brief Cost of ConvolutionInputGenerator_1D, reading Stride_x pixels per output window
+ */
+template<unsigned int ConvKernelDim_x, unsigned int IFMChannels, unsigned int Input_precision, unsigned int IFMDim_x,
+         unsigned int OFMDim_x, unsigned int Stride_x, unsigned int SIMD>
+struct ConvolutionInputGenerator_1D : public Cost<
+    1 + OFMDim_x * ConvKernelDim_x * (IFMChannels/SIMD + 0ull),
+    (ConvKernelDim_x - 1ull) * IFMChannels * Input_precision,
+    IFMDim_x * (IFMChannels/SIMD + 0ull), ConvKernelDim_x * (IFMChannels/SIMD + 0ull),
+    Stride_x * (IFMChannels/SIMD + 0ull), ConvKernelDim_x * (IFMChannels/SIMD + 0ull)> {};
+
+/**
+ * \brief Cost of ConvolutionInputGenerator_1D_dws_stride, reading Stride_x pixels per output window
+ */
+template<unsigned int ConvKernelDim_x, unsigned int IFMChannels, unsigned int Input_precision, unsigned int IFMDim_x,
+         unsigned int OFMDim_x, unsigned int Stride_x, unsigned int SIMD>
+struct ConvolutionInputGenerator_1D_dws_stride : public Cost<
+    1 + (IFMChannels/SIMD - 1ull) * (ConvKernelDim_x - 1) + OFMDim_x * ConvKernelDim_x * (IFMChannels/SIMD + 0ull),
+    (ConvKernelDim_x + 0ull) * IFMChannels * Input_precision,
+    IFMDim_x * (IFMChannels/SIMD + 0ull), ConvKernelDim_x * (IFMChannels/SIMD + 0ull),
+    Stride_x * (IFMChannels/SIMD + 0ull), ConvKernelDim_x * (IFMChannels/SIMD + 0ull)> {};
+
+/**
+ * \brief Cost of ConvolutionInputGenerator_1D_dws
+ */
+template<unsigned int ConvKernelDim_x, unsigned int IFMChannels, unsigned int Input_precision, unsigned int IFMDim_x,
+         unsigned int OFMDim_x, unsigned int SIMD>
+struct ConvolutionInputGenerator_1D_dws : public ConvolutionInputGenerator_1D_dws_stride<
+    ConvKernelDim_x, IFMChannels, Input_precision, IFMDim_x, OFMDim_x, 1, SIMD> {};
+
+/**
+ * \brief Cost of Matrix_Vector_Activate_Batch
+ *
+ * \tparam WeightBits     Bits per weight
+ * \tparam InputBits      Bits per input element
+ * \tparam ThresholdBits  Bits of the activation parameters (e.g. all thresholds) per output row
+ * \tparam Reps           Input words per image, as passed in reps (e.g. OFMDim*OFMDim/MMV)
+ */
+template<unsigned int MatrixW, unsigned int MatrixH, unsigned int SIMD, unsigned int PE, unsigned int MMV,
+         unsigned int WeightBits, unsigned int InputBits, unsigned int ThresholdBits = 0, unsigned int Reps = 1>
+struct Matrix_Vector_Activate_Batch : public Cost<
+    Reps * (MatrixH/PE) * (MatrixW/SIMD + 0ull),
+    (MatrixW * MatrixH + 0ull) * WeightBits + (MatrixH + 0ull) * ThresholdBits + (MMV * MatrixW + 0ull) * InputBits,
+    Reps * (MatrixW/SIMD + 0ull), 0, MatrixW/SIMD, (MatrixH/PE) * (MatrixW/SIMD + 0ull)> {};
+
+/**
+ * \brief Cost of Matrix_Vector_Activate_Prefetch_Batch, the second input vector buffer doubles the input
+ * bits and, with more than one neuron fold, moves the read of every further input vector SF cycles
+ * ahead of the neuron fold loop
+ *
+ * \tparam WeightBits     Bits per weight
+ * \tparam InputBits      Bits per input element
+ * \tparam ThresholdBits  Bits of the activation parameters (e.g. all thresholds) per output row
+ * \tparam Reps           Input words per image, as passed in reps (e.g. OFMDim*OFMDim/MMV)
+ */
+template<unsigned int MatrixW, unsigned int MatrixH, unsigned int SIMD, unsigned int PE, unsigned int MMV,
+         unsigned int WeightBits, unsigned int InputBits, unsigned int ThresholdBits = 0, unsigned int Reps = 1>
+struct Matrix_Vector_Activate_Prefetch_Batch : public Cost<
+    Reps * (MatrixH/PE) * (MatrixW/SIMD + 0ull),
+    (MatrixW * MatrixH + 0ull) * WeightBits + (MatrixH + 0ull) * ThresholdBits + 2 * (MMV * MatrixW + 0ull) * InputBits,
+    Reps * (MatrixW/SIMD + 0ull), (MatrixH/PE > 1? MatrixW/SIMD : 0), MatrixW/SIMD, (MatrixH/PE) * (MatrixW/SIMD + 0ull)> {};
+
+/**
+ * \brief Cost of Matrix_Vector_Activate_Sparse_Batch with NZ stored weight tiles. The cycles depend on how
+ * the tiles are distributed over the neuron folds: cycles_per_image and ideal_fifo_depth are upper bounds,
+ * counting one cycle per stored tile plus one per further neuron fold on top of the MatrixW/SIMD cycles the
+ * dense first fold always takes. The buffer includes the synapse fold index of every tile, the
+ * first tile index of every neuron fold and the cycle count per input vector.
+ *
+ * \tparam WeightBits     Bits per weight
+ * \tparam InputBits      Bits per input element
+ * \tparam ThresholdBits  Bits of the activation parameters (e.g. all thresholds) per output row
+ * \tparam Reps           Input words per image, as passed in reps (e.g. OFMDim*OFMDim/MMV)
+ */
+template<unsigned int MatrixW, unsigned int MatrixH, unsigned int SIMD, unsigned int PE, unsigned int MMV, unsigned int NZ,
+         unsigned int WeightBits, unsigned int InputBits, unsigned int ThresholdBits = 0, unsigned int Reps = 1>
+struct Matrix_Vector_Activate_Sparse_Batch : public Cost<
+    Reps * (MatrixW/SIMD + NZ + MatrixH/PE - 1ull),
+    (NZ * SIMD * PE + 0ull) * WeightBits + (MatrixH + 0ull) * ThresholdBits + (MMV * MatrixW + 0ull) * InputBits +
+      NZ * cmax(clog2(MatrixW/SIMD), 1) + (MatrixH/PE + 1ull) * cmax(clog2(NZ + 1), 1) +
+      clog2(MatrixW/SIMD + NZ + MatrixH/PE),
+    Reps * (MatrixW/SIMD + 0ull), 0, MatrixW/SIMD, MatrixW/SIMD + NZ + MatrixH/PE - 1ull> {};
+
+/**
+ * \brief Cost of Matrix_Vector_Activate_Stream_Batch, weights are not stored
+ */
+template<unsigned int MatrixW, unsigned int MatrixH, unsigned int SIMD, unsigned int PE, unsigned int MMV,
+         unsigned int InputBits, unsigned int ThresholdBits = 0, unsigned int Reps = 1>
+struct Matrix_Vector_Activate_Stream_Batch : public Matrix_Vector_Activate_Batch<
+    MatrixW, MatrixH, SIMD, PE, MMV, 0, InputBits, ThresholdBits, Reps> {};
+
+/**
+ * \brief Cost of Vector_Vector_Activate_Batch, a new input word is read every cycle
+ *
+ * \tparam WeightBits     Bits per weight
+ * \tparam ThresholdBits  Bits of the activation parameters (e.g. all thresholds) per channel
+ * \tparam Reps           Input windows per image, as passed in reps (e.g. OFMDim*OFMDim/MMV)
+ */
+template<unsigned int Channels, unsigned int Kernel_2, unsigned int SIMD, unsigned int PE, unsigned int MMV,
+         unsigned int WeightBits, unsigned int ThresholdBits = 0, unsigned int Reps = 1>
+struct Vector_Vector_Activate_Batch : public Cost<
+    Reps * (Channels/PE) * (Kernel_2/SIMD + 0ull),
+    (Channels * Kernel_2 + 0ull) * WeightBits + (Channels + 0ull) * ThresholdBits,
+    Reps * (Channels/PE) * (Kernel_2/SIMD + 0ull), 0, 1, 1> {};
+
+/**
+ * \brief Cost of StreamingMaxPool and StreamingMaxPool_Precision, reading PoolDim input rows and
+ * writing one output row per pooled row
+ *
+ * \tparam ActBits        Bits per channel, 1 for StreamingMaxPool
+ */
+template<unsigned int ImgDim, unsigned int PoolDim, unsigned int NumChannels, unsigned int ActBits = 1>
+struct StreamingMaxPool : public Cost<
+    (ImgDim/PoolDim) * (ImgDim * PoolDim + ImgDim/PoolDim + 0ull),
+    (ImgDim/PoolDim) * (NumChannels + 0ull) * ActBits,
+    ImgDim * ImgDim + 0ull, 0, ImgDim * PoolDim, ImgDim * PoolDim + ImgDim/PoolDim> {};
+
+/**
+ * \brief Cost of StreamingMaxPool_Batch and StreamingMaxPool_Precision_Batch per image
+ */
+template<unsigned int ImgDim, unsigned int PoolDim, unsigned int NumChannels, unsigned int ActBits = 1>
+struct StreamingMaxPool_Batch : public StreamingMaxPool<ImgDim, PoolDim, NumChannels, ActBits> {};
+
+/**
+ * \brief Cost of StreamingMaxPool_Precision_1d and StreamingMaxPool_Precision_Batch_1d per image, clearing
+ * the buffer, then reading PoolDim input pixels and writing one output pixel per output position
+ *
+ * \tparam ActBits        Bits per channel
+ */
+template<unsigned int ImgDim, unsigned int PoolDim, unsigned int NumChannels, unsigned int PE, unsigned int OutputSize,
+         unsigned int ActBits>
+struct StreamingMaxPool_1d : public Cost<
+    (1 + OutputSize + ImgDim) * (NumChannels/PE + 0ull),
+    (NumChannels + 0ull) * ActBits,
+    ImgDim * (NumChannels/PE + 0ull), 0, PoolDim * (NumChannels/PE), (PoolDim + 1) * (NumChannels/PE)> {};
+
+/**
+ * \brief Cost of StreamingMaxPool_Precision_2d, one input word per cycle and one pooled
+ * row per open output row
+ *
+ * \tparam ActBits        Bits per channel
+ */
+template<unsigned int ImgDimX, unsigned int ImgDimY, unsigned int PoolDimX, unsigned int PoolDimY,
+         unsigned int StrideX, unsigned int StrideY, unsigned int NumChannels, unsigned int PE, unsigned int ActBits>
+struct StreamingMaxPool_2d : public Cost<
+    ImgDimX * ImgDimY * (NumChannels/PE + 0ull),
+    ((PoolDimY + StrideY - 1)/StrideY * ((ImgDimX - PoolDimX)/StrideX + 1) +
+     (PoolDimX + StrideX - 1)/StrideX) * (NumChannels + 0ull) * ActBits,
+    ImgDimX * ImgDimY * (NumChannels/PE + 0ull), 0, 1, 1> {};
+
+/**
+ * \brief Cost of GlobalAccPool_Batch, one input word per cycle and no line buffer
+ *
+ * \tparam AccBits        Bits per accumulator
+ */
+template<unsigned int ImgDim, unsigned int NumChannels, unsigned int PECount, unsigned int AccBits>
+struct GlobalAccPool_Batch : public Cost<
+    ImgDim * ImgDim * (NumChannels/PECount + 0ull),
+    (NumChannels + 0ull) * AccBits,
+    ImgDim * ImgDim * (NumChannels/PECount + 0ull), 0, 1, 1> {};
+
+/**
+ * \brief Cost of Softmax_Batch, whose three passes over the words of a pixel run as dataflow stages
+ * connected by FIFOs holding two pixels, so that the layer reads one word per cycle
+ *
+ * The last pixel of an image leaves the layer two passes after it has been read; the pipeline fill of
+ * the stages adds a few cycles more.
+ *
+ * \tparam InBits         Bits per input channel
+ */
+template<unsigned int ImgDim, unsigned int NumChannels, unsigned int PE, unsigned int InBits>
+struct Softmax_Batch : public Cost<
+    (ImgDim + 2ull) * (NumChannels/PE),
+    4ull * NumChannels * InBits,
+    ImgDim * (NumChannels/PE + 0ull), 0, 1, 1> {};
+
+} // namespace cost
+
+#endif
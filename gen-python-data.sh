@@ -39,6 +39,8 @@ python3 gen_weigths.py
 python3 gen_weigths_dws.py
 python3 gen_weigths_nonsquare.py
 python3 gen_weigths_nonsquare_dws.py
+python3 gen_weigths_transposed.py
+python3 gen_weigths_dwsep.py
 python3 gen_params_stmr.py tmrcheck
 python3 gen_params_stmr.py no_inj
 python3 gen_params_stmr.py inj
@@ -63,6 +63,11 @@ class XnorMul {
   }
 
  public:
+  ap_uint<1> value() const {
+#pragma HLS inline
+    return  m_val;
+  }
+
   int operator*(ap_uint<1> const &b) const {
 #pragma HLS inline
     return  m_val == b? 1 : 0;
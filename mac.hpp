@@ -64,6 +64,10 @@
 #define MAC_HPP
 
 #include "utils.hpp"
+#include "interpret.hpp"
+
+#include <type_traits>
+#include <utility>
 
 
 /**
@@ -74,6 +78,7 @@
  * ap_resource_dflt will let HLS choose the best one
  * ap_resource_lut will force HLS to implement the multiplier in LUTs
  * ap_resource_dsp will force HLS to implement the multiplier in DSP48
+ * ap_resource_dsp_packed will pack two narrow products into one DSP48 (see mac)
  *
  * \tparam     TC    First operand datatype (weights)
  * \tparam     TD    Second operand datatype (input)
@@ -99,6 +104,7 @@ auto mul(TC const &c, TD const &d, ap_resource_dflt const&) -> decltype(c*d) {
  * ap_resource_dflt will let HLS choose the best one
  * ap_resource_lut will force HLS to implement the multiplier in LUTs
  * ap_resource_dsp will force HLS to implement the multiplier in DSP48
+ * ap_resource_dsp_packed will pack two narrow products into one DSP48 (see mac)
  *
  * \tparam     TC    First operand datatype (weights)
  * \tparam     TD    Second operand datatype (input)
@@ -125,6 +131,7 @@ auto mul(TC const &c, TD const &d, ap_resource_lut const&) -> decltype(c*d) {
  * ap_resource_dflt will let HLS choose the best one
  * ap_resource_lut will force HLS to implement the multiplier in LUTs
  * ap_resource_dsp will force HLS to implement the multiplier in DSP48
+ * ap_resource_dsp_packed will pack two narrow products into one DSP48 (see mac)
  *
  * \tparam     TC    First operand datatype (weights)
  * \tparam     TD    Second operand datatype (input)
@@ -143,6 +150,223 @@ auto mul(TC const &c, TD const &d, ap_resource_dsp const&) -> decltype(c*d) {
   return  res;
 }
 
+/**
+ * \brief      Multiply operation between 2 operands, implemented in a DSP48
+ *
+ * A single product cannot share a DSP48 with another one, so ap_resource_dsp_packed
+ * degenerates to ap_resource_dsp here. Packing is applied by mac, which has
+ * pairs of products to combine.
+ *
+ * \tparam     TC    First operand datatype (weights)
+ * \tparam     TD    Second operand datatype (input)
+ * 
+ * \param      c     First operand (array of weights)
+ * \param      d     Second operand (array of input activation)
+ * \param      r     Resource type for the hardware implementation of the MAC block
+ *
+ * \return     Result of the multiply operation
+ */
+template<typename TC, typename TD>
+auto mul(TC const &c, TD const &d, ap_resource_dsp_packed const&) -> decltype(c*d) {
+#pragma HLS inline
+  return  mul(c, d, ap_resource_dsp());
+}
+
+//- DSP48 Packing ------------------------------------------------------------
+/**
+ * \brief      Operand properties relevant to the DSP48 packing
+ *
+ * Only plain integer operands can be packed. Unsigned operands are handled as
+ * signed operands with one extra bit.
+ */
+template<typename T>
+struct dsp_packing_traits {
+  static bool     const  packable = false;
+  static unsigned const  width    = 0;
+};
+template<int W>
+struct dsp_packing_traits<ap_int<W>> {
+  static bool     const  packable = true;
+  static unsigned const  width    = W;
+};
+template<int W>
+struct dsp_packing_traits<ap_uint<W>> {
+  static bool     const  packable = true;
+  static unsigned const  width    = W+1;
+};
+
+/**
+ * \brief      Sum of two products c0*d0 + c1*d1 computed by a single multiplication
+ *
+ * The operands are packed as (d0*2^S + d1) * (c0 + c1*2^S) so that the bit field
+ * starting at position S of the product holds c0*d0 + c1*d1. The lower field c0*d1
+ * is signed and borrows one from the middle field when negative, which is corrected
+ * by adding back its sign bit. The field width S is chosen to hold the sum of two
+ * products. The packed operands must fit the 27x18 signed multiplier of a DSP48E2,
+ * otherwise two separate products are computed, each in a DSP48 as for ap_resource_dsp.
+ *
+ * A packed operand spans S+1 bits plus the width of its upper operand, and the narrower
+ * one must fit the 18-bit port. With operands of equal width W, 3*W+2 <= 18 limits the
+ * packing to 5-bit signed (4-bit unsigned) operands; 8-bit operands are not packed.
+ * The INT8 packing of two products sharing one operand would pair products of
+ * different PEs rather than of adjacent SIMD lanes and is not implemented.
+ *
+ * \tparam     WC    Width of the first operands (weights), as signed value
+ * \tparam     WD    Width of the second operands (input), as signed value
+ */
+template<unsigned WC, unsigned WD,
+  bool PACK = (WC+WD+2+(WC<WD? WC:WD) <= 18) && (WC+WD+2+(WC<WD? WD:WC) <= 27)>
+struct DspPackedMul2 {
+  template<typename TC, typename TD>
+  static ap_int<WC+WD+1> mul2(TC const &c0, TD const &d0, TC const &c1, TD const &d1) {
+#pragma HLS inline
+    constexpr unsigned  S = WC+WD+1;
+    ap_int<S+WD+1> const  dp = (ap_int<S+WD+1>(ap_int<WD>(d0)) << S) + ap_int<WD>(d1);
+    ap_int<S+WC+1> const  cp = (ap_int<S+WC+1>(ap_int<WC>(c1)) << S) + ap_int<WC>(c0);
+    ap_int<2*S+WC+WD+2> const  p = dp * cp;
+#pragma HLS BIND_OP variable=p op=mul impl=dsp
+    ap_int<S> const  res = ap_uint<S>(p(2*S-1, S)) + ap_uint<1>(p[S-1]);
+    return  res;
+  }
+};
+template<unsigned WC, unsigned WD>
+struct DspPackedMul2<WC, WD, false> {
+  template<typename TC, typename TD>
+  static auto mul2(TC const &c0, TD const &d0, TC const &c1, TD const &d1) -> decltype(c0*d0 + c1*d1) {
+#pragma HLS inline
+    return  mul(c0, d0, ap_resource_dsp()) + mul(c1, d1, ap_resource_dsp());
+  }
+};
+
+/**
+ * \brief      Sum of two products, packed into a single DSP48 whenever the operand types allow it
+ *
+ * Operands which are not plain integers (e.g. Binary, XnorMul or ap_fixed) are
+ * multiplied individually like the products that are too wide to be packed, i.e.
+ * as for ap_resource_dsp.
+ */
+template<typename TC, typename TD,
+  bool PACKABLE = dsp_packing_traits<TC>::packable && dsp_packing_traits<TD>::packable>
+struct DspPackedMac {
+  static auto mul2(TC const &c0, TD const &d0, TC const &c1, TD const &d1)
+    -> decltype(DspPackedMul2<dsp_packing_traits<TC>::width, dsp_packing_traits<TD>::width>::mul2(c0, d0, c1, d1)) {
+#pragma HLS inline
+    return  DspPackedMul2<dsp_packing_traits<TC>::width, dsp_packing_traits<TD>::width>::mul2(c0, d0, c1, d1);
+  }
+};
+template<typename TC, typename TD>
+struct DspPackedMac<TC, TD, false> {
+  static auto mul2(TC const &c0, TD const &d0, TC const &c1, TD const &d1) -> decltype(c0*d0 + c1*d1) {
+#pragma HLS inline
+    return  mul(c0, d0, ap_resource_dsp()) + mul(c1, d1, ap_resource_dsp());
+  }
+};
+
+//- Popcount for binary Operands ---------------------------------------------
+/**
+ * \brief      Population count implemented as an adder tree over six-bit counts
+ *
+ * The input is split into chunks of at most six bits, whose counts each map
+ * onto three LUT6s, and the partial counts are summed by a balanced adder tree.
+ *
+ * \tparam     N     Width of the input word
+ */
+template<unsigned N, bool LEAF = (N <= 6)>
+struct Popcount {
+  static ap_uint<clog2(N+1)> count(ap_uint<N> const &x) {
+#pragma HLS inline
+    // split on a six-bit boundary with the lower half holding the larger share
+    constexpr unsigned  NL = 6*((N+11)/12);
+    ap_uint<NL>   const  lo = x(NL-1, 0);
+    ap_uint<N-NL> const  hi = x(N-1, NL);
+    ap_uint<clog2(N+1)> const  res = Popcount<NL>::count(lo) + Popcount<N-NL>::count(hi);
+    return  res;
+  }
+};
+template<unsigned N>
+struct Popcount<N, true> {
+  static ap_uint<clog2(N+1)> count(ap_uint<N> const &x) {
+#pragma HLS inline
+    ap_uint<clog2(N+1)>  res = 0;
+    for(unsigned  i = 0; i < N; i++) {
+#pragma HLS unroll
+      res += x[i];
+    }
+    return  res;
+  }
+};
+
+/**
+ * \brief      MAC as a sum of individual products, generic case
+ *
+ * \tparam     TCE   Element datatype of the first operand (weights)
+ * \tparam     TDE   Element datatype of the second operand (input)
+ */
+template<typename TCE, typename TDE>
+struct PopcountMac {
+  template<unsigned N, typename T, typename TC, typename TD, typename R>
+  static T mac(T const &a, TC const &c, TD const &d, R const &r, unsigned mmv) {
+#pragma HLS inline
+    T  res = a;
+    for(unsigned  i = 0; i < N; i++) {
+#pragma HLS unroll
+      res += mul(c[i], d(i,mmv), r);
+    }
+    return  res;
+  }
+};
+
+/**
+ * \brief      MAC of XnorMul weights and single-bit inputs
+ *
+ * The XNOR is computed over the whole SIMD word and reduced by a single
+ * popcount, which is added to the accumulator once.
+ */
+template<>
+struct PopcountMac<XnorMul, ap_uint<1>> {
+  template<unsigned N, typename T, typename TC, typename TD, typename R>
+  static T mac(T const &a, TC const &c, TD const &d, __attribute__((unused)) R const &r, unsigned mmv) {
+#pragma HLS inline
+    ap_uint<N>  cw;
+    ap_uint<N>  dw;
+    for(unsigned  i = 0; i < N; i++) {
+#pragma HLS unroll
+      cw[i] = c[i].value();
+      dw[i] = d(i,mmv);
+    }
+    ap_uint<N> const  x = ~(cw ^ dw);
+    T  res = a;
+    res += Popcount<N>::count(x);
+    return  res;
+  }
+};
+
+/**
+ * \brief      MAC of Binary weights and Binary inputs
+ *
+ * With both operands in {-1,+1}, the sum of the N products equals
+ * 2*popcount(XNOR) - N, which needs a single popcount and one addition.
+ */
+template<>
+struct PopcountMac<Binary, Binary> {
+  template<unsigned N, typename T, typename TC, typename TD, typename R>
+  static T mac(T const &a, TC const &c, TD const &d, __attribute__((unused)) R const &r, unsigned mmv) {
+#pragma HLS inline
+    ap_uint<N>  cw;
+    ap_uint<N>  dw;
+    for(unsigned  i = 0; i < N; i++) {
+#pragma HLS unroll
+      cw[i] = c[i].m_val;
+      dw[i] = d(i,mmv).m_val;
+    }
+    ap_uint<N> const  x = ~(cw ^ dw);
+    ap_int<clog2(N+1)+2> const  pc = Popcount<N>::count(x);
+    T  res = a;
+    res += 2*pc - ap_int<clog2(N+1)+2>(N);
+    return  res;
+  }
+};
+
 /**
  * \brief      MAC with selectable implementation resource, used by Matrix_Vector_Activate_Batch
  *
@@ -163,12 +387,9 @@ auto mul(TC const &c, TD const &d, ap_resource_dsp const&) -> decltype(c*d) {
 template<unsigned N, typename T, typename TC, typename TD, typename R>
 T mac(T const &a, TC const &c, TD const &d, R const &r, unsigned mmv) {
 #pragma HLS inline
-  T  res = a;
-  for(unsigned  i = 0; i < N; i++) {
-#pragma HLS unroll
-    res += mul(c[i], d(i,mmv), r);
-  }
-  return  res;
+  using  TCE = typename std::decay<decltype(c[0])>::type;
+  using  TDE = typename std::decay<decltype(d(0,mmv))>::type;
+  return  PopcountMac<TCE, TDE>::template mac<N>(a, c, d, r, mmv);
 }
 
 /**
@@ -197,10 +418,228 @@ T mac(T const &a, TC const &c, TD const &d, R const &r) {
   }
   return  res;
 }
+/**
+ * \brief      MAC packing pairs of narrow products into DSP48s, used by Matrix_Vector_Activate_Batch
+ *
+ * Pairs of adjacent SIMD lanes are combined into one multiplication so that
+ * 4-bit (and narrower) layers obtain two MACs per DSP48. Operand combinations
+ * that do not fit the DSP48 are computed with one DSP48 per product.
+ *
+ * \tparam     N     Number of MAC to be performed (equals to SIMD in mvau)
+ * \tparam     T     Accumulator datatype
+ * \tparam     TC    First operand datatype (weights)
+ * \tparam     TD    Second operand datatype (input)
+ * 
+ * \param      a     Initialization value of the accumulation
+ * \param      c     First operand (array of weights)
+ * \param      d     Second operand (array of input activation)
+ * \param      r     Resource type for the hardware implementation of the MAC block
+ * \param      mmv   MMV value to address accumulator and activation
+ *
+ * \return     Result of the MAC operation
+ */
+template<unsigned N, typename T, typename TC, typename TD>
+T mac(T const &a, TC const &c, TD const &d, ap_resource_dsp_packed const &r, unsigned mmv) {
+#pragma HLS inline
+  using  TCE = typename std::decay<decltype(c[0])>::type;
+  using  TDE = typename std::decay<decltype(d(0,mmv))>::type;
+  T  res = a;
+  for(unsigned  i = 0; i+1 < N; i += 2) {
+#pragma HLS unroll
+    TCE const  c0 = c[i];
+    TCE const  c1 = c[i+1];
+    TDE const  d0 = d(i,mmv);
+    TDE const  d1 = d(i+1,mmv);
+    res += DspPackedMac<TCE, TDE>::mul2(c0, d0, c1, d1);
+  }
+  if(N%2)  res += mul(c[N-1], d(N-1,mmv), r);
+  return  res;
+}
+
+/**
+ * \brief      MAC packing pairs of narrow products into DSP48s, used by Matrix_Vector_Activate_Batch
+ *
+ * \tparam     N     Number of MAC to be performed (equals to SIMD in mvau)
+ * \tparam     T     Accumulator datatype
+ * \tparam     TC    First operand datatype (weights)
+ * \tparam     TD    Second operand datatype (input)
+ * 
+ * \param      a     Initialization value of the accumulation
+ * \param      c     First operand (array of weights)
+ * \param      d     Second operand (array of input activation)
+ * \param      r     Resource type for the hardware implementation of the MAC block
+ *
+ * \return     Result of the MAC operation
+ */
+template<unsigned N, typename T, typename TC, typename TD>
+T mac(T const &a, TC const &c, TD const &d, ap_resource_dsp_packed const &r) {
+#pragma HLS inline
+  using  TCE = typename std::decay<decltype(c[0])>::type;
+  using  TDE = typename std::decay<decltype(d[0])>::type;
+  T  res = a;
+  for(unsigned  i = 0; i+1 < N; i += 2) {
+#pragma HLS unroll
+    TCE const  c0 = c[i];
+    TCE const  c1 = c[i+1];
+    TDE const  d0 = d[i];
+    TDE const  d1 = d[i+1];
+    res += DspPackedMac<TCE, TDE>::mul2(c0, d0, c1, d1);
+  }
+  if(N%2)  res += mul(c[N-1], d[N-1], r);
+  return  res;
+}
 template<unsigned N, typename T, typename TC, typename TD>
 inline T mac(T const &a, TC const &c, TD const &d) {
 #pragma HLS inline
   return  mac<N>(a, c, d, ap_resource_dflt());
 }
 
+//- Accumulator Width Inference ---------------------------------------------
+/**
+ * \brief      Value range of a MAC operand, if known at compile time
+ *
+ * Only integer types of up to 16 bits as well as the Binary and XnorMul
+ * wrappers have a known range. All other operands opt out of the inference.
+ */
+template<typename T>
+struct mac_operand_traits {
+  static constexpr bool       known = false;
+  static constexpr long long  min   = 0;
+  static constexpr long long  max   = 0;
+};
+template<int W>
+struct mac_operand_traits<ap_int<W>> {
+  static constexpr bool       known = W <= 16;
+  static constexpr long long  min   = known? -(1LL << (W-1))    : 0;
+  static constexpr long long  max   = known?  (1LL << (W-1)) - 1 : 0;
+};
+template<int W>
+struct mac_operand_traits<ap_uint<W>> {
+  static constexpr bool       known = W <= 16;
+  static constexpr long long  min   = 0;
+  static constexpr long long  max   = known? (1LL << W) - 1 : 0;
+};
+template<>
+struct mac_operand_traits<Binary> {
+  static constexpr bool       known = true;
+  static constexpr long long  min   = -1;
+  static constexpr long long  max   =  1;
+};
+
+constexpr long long min4(long long a, long long b, long long c, long long d) {
+  return  a < b? (a < c? (a < d? a : d) : (c < d? c : d)) : (b < c? (b < d? b : d) : (c < d? c : d));
+}
+constexpr long long max4(long long a, long long b, long long c, long long d) {
+  return  -min4(-a, -b, -c, -d);
+}
+
+/**
+ * \brief      Value range of a single product c*d
+ *
+ * \tparam     TC    First operand datatype (weights)
+ * \tparam     TD    Second operand datatype (input)
+ */
+template<typename TC, typename TD>
+struct mac_product_traits {
+  using  C = mac_operand_traits<TC>;
+  using  D = mac_operand_traits<TD>;
+  static constexpr bool       known = C::known && D::known;
+  static constexpr long long  min   = min4(C::min*D::min, C::min*D::max, C::max*D::min, C::max*D::max);
+  static constexpr long long  max   = max4(C::min*D::min, C::min*D::max, C::max*D::min, C::max*D::max);
+};
+template<typename TD>
+struct mac_product_traits<XnorMul, TD> {
+  static constexpr bool       known = true;
+  static constexpr long long  min   = 0;
+  static constexpr long long  max   = 1;
+};
+
+/**
+ * \brief      Bit width needed to represent all values in [min, max]
+ */
+constexpr unsigned range_width(long long const  min, long long const  max) {
+  return  min < 0? 1 + (clog2(-min) > clog2(max+1)? clog2(-min) : clog2(max+1)) :
+          max < 2? 1 : clog2(max+1);
+}
+
+/**
+ * \brief      Smallest accumulator for the sum of N products c*d
+ *
+ * The resulting type can be used as accumulator type of the activation,
+ * e.g. PassThroughActivation<typename MacAccumulator<SIMD*SF, TW, TI>::type>.
+ *
+ * \tparam     N     Number of accumulated products (e.g. MatrixW in mvau, Kernel_2 in vvau)
+ * \tparam     TC    First operand datatype (weights)
+ * \tparam     TD    Second operand datatype (input)
+ */
+template<unsigned N, typename TC, typename TD>
+struct MacAccumulator {
+  using  P = mac_product_traits<TC, TD>;
+  static constexpr bool       known     = P::known;
+  static constexpr long long  min       = N * P::min;
+  static constexpr long long  max       = N * P::max;
+  static constexpr bool       is_signed = min < 0;
+  static constexpr unsigned   width     = range_width(min, max);
+  using  type = typename std::conditional<is_signed, ap_int<width>, ap_uint<width>>::type;
+};
+
+/**
+ * \brief      Value range of an accumulator type, if known at compile time
+ */
+template<typename T>
+struct mac_accu_traits {
+  static constexpr bool       known = false;
+  static constexpr long long  min   = 0;
+  static constexpr long long  max   = 0;
+};
+template<int W>
+struct mac_accu_traits<ap_int<W>> {
+  static constexpr bool       known = W < 64;
+  static constexpr long long  min   = known? -(1LL << (W-1))    : 0;
+  static constexpr long long  max   = known?  (1LL << (W-1)) - 1 : 0;
+};
+template<int W>
+struct mac_accu_traits<ap_uint<W>> {
+  static constexpr bool       known = W < 63;
+  static constexpr long long  min   = 0;
+  static constexpr long long  max   = known? (1LL << W) - 1 : 0;
+};
+
+/**
+ * \brief      Element datatypes of the (interpreted) weight and input containers passed to mac
+ */
+template<typename TC>
+using mac_weight_t = typename std::decay<decltype(std::declval<TC const&>()[0])>::type;
+template<typename TD>
+using mac_input_t  = typename std::decay<decltype(std::declval<TD const&>()(0,0))>::type;
+
+/**
+ * Compile-time checking of the accumulator width in the MVAU and VVAU is
+ * enabled by defining FINN_HLSLIB_CHECK_ACCU_WIDTH to 1. It is disabled by
+ * default as the worst-case bound may exceed accumulators which have been
+ * sized from the actual weight values.
+ */
+#ifndef FINN_HLSLIB_CHECK_ACCU_WIDTH
+#define FINN_HLSLIB_CHECK_ACCU_WIDTH 0
+#endif
+
+/**
+ * \brief      Checks that an accumulator of type TA can hold the sum of N products c*d
+ *
+ * The range of the sum must lie within the signed or unsigned range of TA, so
+ * that e.g. an ap_int<W> is rejected for an unsigned sum that needs all W bits
+ * of an ap_uint<W>. Operands or accumulators of unknown range pass the check.
+ *
+ * \tparam     TA    Accumulator datatype
+ * \tparam     N     Number of accumulated products
+ * \tparam     TC    First operand datatype (weights)
+ * \tparam     TD    Second operand datatype (input)
+ */
+template<typename TA, unsigned N, typename TC, typename TD>
+constexpr bool mac_accumulator_fits() {
+  using  A = MacAccumulator<N, typename std::decay<TC>::type, typename std::decay<TD>::type>;
+  using  T = mac_accu_traits<TA>;
+  return  !A::known || !T::known || ((T::min <= A::min) && (A::max <= T::max));
+}
+
 #endif
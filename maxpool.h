@@ -49,7 +49,9 @@
 #include <limits>
 
 #include "interpret.hpp"
+#include "activations.hpp"
 #include "utils.hpp"
+#include "costmodel.hpp"
 
 /**
  * \brief   Max Pool implementation for Binarized values 
@@ -70,6 +72,10 @@ void StreamingMaxPool(hls::stream<ap_uint<NumChannels> > & in,
   static_assert(ImgDim % PoolDim == 0, "");
   // need buffer space for a single maxpooled row of the image
   ap_uint<NumChannels> buf[ImgDim / PoolDim];
+  // the cost model accounts for the row buffer and one cycle per input and output pixel
+  static_assert(cost::StreamingMaxPool<ImgDim, PoolDim, NumChannels>::buffer_bits == (ImgDim / PoolDim) * NumChannels, "");
+  static_assert(cost::StreamingMaxPool<ImgDim, PoolDim, NumChannels>::cycles_per_image ==
+    ImgDim * ImgDim + (ImgDim / PoolDim) * (ImgDim / PoolDim), "");
   for(unsigned int i = 0; i < ImgDim / PoolDim; i++) {
 #pragma HLS UNROLL
     buf[i] = 0;
@@ -144,6 +150,11 @@ void StreamingMaxPool_Precision(hls::stream<ap_uint<StreamW> > & in,
   // need buffer space for a single maxpooled row of the image
   ActType buf[ImgDim / PoolDim][NumChannels];
 #pragma HLS ARRAY_PARTITION variable=buf complete dim=2
+  // the cost model accounts for the row buffer and one cycle per input and output pixel
+  static_assert(cost::StreamingMaxPool<ImgDim, PoolDim, NumChannels, ActType::width>::buffer_bits ==
+    (ImgDim / PoolDim) * NumChannels * ActType::width, "");
+  static_assert(cost::StreamingMaxPool<ImgDim, PoolDim, NumChannels, ActType::width>::cycles_per_image ==
+    ImgDim * ImgDim + (ImgDim / PoolDim) * (ImgDim / PoolDim), "");
   for(unsigned int i = 0; i < ImgDim / PoolDim; i++) {
     for(unsigned int ch = 0; ch<NumChannels; ch++){
 #pragma HLS UNROLL
@@ -253,6 +264,8 @@ void StreamingMaxPool_Precision_1d(hls::stream<ap_uint<PE*ActType::width> > & in
   // need buffer space for a single maxpooled pixel of the image
   ActType buf[NF][PE];
 #pragma HLS ARRAY_PARTITION variable=buf complete dim=2
+  static_assert(cost::StreamingMaxPool_1d<ImgDim, PoolDim, NumChannels, PE, OutputSize, ActType::width>::buffer_bits ==
+                NF * PE * ActType::width, "");
 
   for(unsigned int ch = 0; ch < NF; ch++){
 #pragma HLS pipeline style=flp II=1
@@ -337,6 +350,193 @@ void StreamingMaxPool_Precision_Batch_1d(hls::stream<ap_uint<PE*ActType::width>
 }
 
 
+/**
+ * \brief   2D Max Pool implementation for non Binarized values, with any kernel and stride
+ *
+ * This function performes the maxpool for non-binary inputs on non-square images, with kernel and stride
+ * set independently in both dimensions (e.g. overlapping 3x3 windows with stride 2) and the channels folded
+ * over PE. Pixels are first reduced horizontally, keeping one running maximum per open window column, then
+ * vertically into a buffer holding one running maximum per output pixel of the open output rows, i.e.
+ * ceil(PoolDimY/StrideY) pooled rows instead of PoolDimY input lines. The output word of a window is written
+ * as soon as its last input word is received. Input pixels not covered by any window are read and dropped.
+ *
+ * \tparam ImgDimX       Width of the Input Feature Map
+ * \tparam ImgDimY       Height of the Input Feature Map
+ * \tparam PoolDimX      Width of the Max Pool kernel
+ * \tparam PoolDimY      Height of the Max Pool kernel
+ * \tparam StrideX       Horizontal stride of the Max Pool kernel
+ * \tparam StrideY       Vertical stride of the Max Pool kernel
+ * \tparam NumChannels   Number of Input Feature Maps
+ * \tparam PE            Number of input rows (channels) computed in parallel
+ * \tparam ActType       DataType of the input activation (as used in the comparison)
+ * \tparam min_value     Minimum value possible with the given ActType, used to initialize the value before the comparison
+ *
+ * \param in             Input stream
+ * \param out            Output stream
+ *
+ */
+template<unsigned int ImgDimX, unsigned int ImgDimY, unsigned int PoolDimX, unsigned int PoolDimY,
+        unsigned int StrideX, unsigned int StrideY, unsigned int NumChannels, unsigned int PE,
+        typename ActType, int min_value
+        >
+void StreamingMaxPool_Precision_2d(hls::stream<ap_uint<PE*ActType::width> > & in,
+        hls::stream<ap_uint<PE*ActType::width> > & out) {
+  static_assert(NumChannels % PE == 0, "");
+  static_assert(ImgDimX >= PoolDimX, "");
+  static_assert(ImgDimY >= PoolDimY, "");
+  constexpr unsigned NF = NumChannels / PE;
+  constexpr unsigned OFMDimX = (ImgDimX - PoolDimX) / StrideX + 1;
+  constexpr unsigned OFMDimY = (ImgDimY - PoolDimY) / StrideY + 1;
+  // number of windows a pixel belongs to in each dimension
+  constexpr unsigned COLS = (PoolDimX + StrideX - 1) / StrideX;
+  constexpr unsigned ROWS = (PoolDimY + StrideY - 1) / StrideY;
+  constexpr unsigned TOTAL_FOLD = ImgDimX * ImgDimY * NF;
+
+  // running maxima of the open windows, horizontally for the current input row
+  // and vertically for the open output rows
+  ActType colbuf[COLS][NF][PE];
+#pragma HLS ARRAY_PARTITION variable=colbuf complete dim=1
+#pragma HLS ARRAY_PARTITION variable=colbuf complete dim=3
+  ActType rowbuf[ROWS][OFMDimX * NF][PE];
+#pragma HLS ARRAY_PARTITION variable=rowbuf complete dim=1
+#pragma HLS ARRAY_PARTITION variable=rowbuf complete dim=3
+  // the cost model accounts for both buffers and at least one cycle per input and output word
+  typedef cost::StreamingMaxPool_2d<ImgDimX, ImgDimY, PoolDimX, PoolDimY, StrideX, StrideY, NumChannels, PE, ActType::width>  KernelCost;
+  static_assert(KernelCost::buffer_bits == (COLS + ROWS * OFMDimX) * NF * PE * ActType::width, "");
+  static_assert(KernelCost::cycles_per_image >= cost::cmax(ImgDimX * ImgDimY * NF, OFMDimX * OFMDimY * NF), "");
+
+  // last window started in each dimension, its buffer slot and the offset of the pixel in it
+  unsigned int ox_last = 0, col_slot = 0, col_phase = 0;
+  unsigned int oy_last = 0, row_slot = 0, row_phase = 0;
+  unsigned int nf = 0, ix = 0;
+  for (unsigned int i = 0; i < TOTAL_FOLD; i++) {
+#pragma HLS pipeline style=flp II=1
+    ap_uint<PE*ActType::width> const  inputData = in.read();
+    ap_uint<PE*ActType::width> outputData;
+    bool  col_done = false;
+    unsigned int ox_done = 0;
+    ActType colmax[PE];
+#pragma HLS ARRAY_PARTITION variable=colmax complete dim=1
+
+    // horizontal reduction into the windows covering this column
+    for (unsigned int j = 0; j < COLS; j++) {
+#pragma HLS UNROLL
+      unsigned int const  slot = col_slot >= j ? col_slot - j : col_slot + COLS - j;
+      bool const  valid = (ox_last >= j) && (ox_last - j < OFMDimX) && (col_phase + j * StrideX < PoolDimX);
+      bool const  first = (j == 0) && (col_phase == 0);
+      bool const  last = col_phase + j * StrideX == PoolDimX - 1;
+      if (valid) {
+        for (unsigned int p = 0; p < PE; p++) {
+#pragma HLS UNROLL
+          unsigned const lowBit = p * ActType::width;
+          unsigned const highBit = (p+1) * ActType::width -1;
+          ActType const channeldata = inputData(highBit, lowBit);
+          ActType const oldMax = first ? ActType(min_value) : colbuf[slot][nf][p];
+          ActType const newMax = channeldata > oldMax ? channeldata : oldMax;
+          colbuf[slot][nf][p] = newMax;
+          if (last) {
+            colmax[p] = newMax;
+          }
+        }
+        if (last) {
+          col_done = true;
+          ox_done = ox_last - j;
+        }
+      }
+    }
+
+    // vertical reduction of a completed column into the open output rows
+    if (col_done) {
+      for (unsigned int j = 0; j < ROWS; j++) {
+#pragma HLS UNROLL
+        unsigned int const  slot = row_slot >= j ? row_slot - j : row_slot + ROWS - j;
+        bool const  valid = (oy_last >= j) && (oy_last - j < OFMDimY) && (row_phase + j * StrideY < PoolDimY);
+        bool const  first = (j == 0) && (row_phase == 0);
+        bool const  last = row_phase + j * StrideY == PoolDimY - 1;
+        if (valid) {
+          for (unsigned int p = 0; p < PE; p++) {
+#pragma HLS UNROLL
+            unsigned const lowBit = p * ActType::width;
+            unsigned const highBit = (p+1) * ActType::width -1;
+            ActType const oldMax = first ? ActType(min_value) : rowbuf[slot][ox_done * NF + nf][p];
+            ActType const newMax = colmax[p] > oldMax ? colmax[p] : oldMax;
+            rowbuf[slot][ox_done * NF + nf][p] = newMax;
+            if (last) {
+              outputData(highBit, lowBit) = newMax;
+            }
+          }
+          // the last window row completes the output pixel
+          if (last) {
+            out.write(outputData);
+          }
+        }
+      }
+    }
+
+    // advance to the next input word
+    if (++nf == NF) {
+      nf = 0;
+      if (++col_phase == StrideX) {
+        col_phase = 0;
+        ox_last++;
+        if (++col_slot == COLS) {
+          col_slot = 0;
+        }
+      }
+      if (++ix == ImgDimX) {
+        ix = 0;
+        ox_last = 0;
+        col_slot = 0;
+        col_phase = 0;
+        if (++row_phase == StrideY) {
+          row_phase = 0;
+          oy_last++;
+          if (++row_slot == ROWS) {
+            row_slot = 0;
+          }
+        }
+      }
+    }
+  }
+}
+
+
+/**
+ * \brief   2D Max Pool implementation for non binarized values on multiple images
+ *
+ * This function performes the maxpool for non binary inputs with any kernel and stride, see StreamingMaxPool_Precision_2d
+ *
+ * \tparam ImgDimX      Width of the Input Feature Map
+ * \tparam ImgDimY      Height of the Input Feature Map
+ * \tparam PoolDimX     Width of the Max Pool kernel
+ * \tparam PoolDimY     Height of the Max Pool kernel
+ * \tparam StrideX      Horizontal stride of the Max Pool kernel
+ * \tparam StrideY      Vertical stride of the Max Pool kernel
+ * \tparam NumChannels  Number of Input Feature Maps
+ * \tparam PE           Number of input rows (channels) computed in parallel
+ * \tparam ActType      DataType of the input activation (as used in the comparison)
+ * \tparam min_value    Minimum value possible with the given ActType, used to initialize the value before the comparison
+ *
+ * \param in            Input stream
+ * \param out           Output stream
+ * \param numReps       Number of time the function has to be repeatedly executed (e.g. number of images)
+ *
+ */
+template<unsigned int ImgDimX, unsigned int ImgDimY, unsigned int PoolDimX, unsigned int PoolDimY,
+        unsigned int StrideX, unsigned int StrideY, unsigned int NumChannels, unsigned int PE,
+        typename ActType, int min_value
+        >
+void StreamingMaxPool_Precision_Batch_2d(hls::stream<ap_uint<PE*ActType::width> > & in,
+        hls::stream<ap_uint<PE*ActType::width> > & out, unsigned int numReps) {
+#pragma HLS INLINE
+  for (unsigned int rep = 0; rep < numReps; rep++) {
+    StreamingMaxPool_Precision_2d<ImgDimX, ImgDimY, PoolDimX, PoolDimY, StrideX, StrideY,
+      NumChannels, PE, ActType, min_value>
+      (in, out);
+  }
+}
+
+
 /**
  * \brief   ReLU for fixed-point or integer; can accept a bias at input, which it removes
  *
@@ -439,6 +639,102 @@ void AccPool_Batch(hls::stream<ap_uint<PECount * ActType::width> > & in,
     }
 }
 
+/**
+ * \brief   Global accumulate-pool - sums every channel over the whole frame in a single pass without any line buffer
+ *
+ * Keeps NumChannels running accumulators, initialized by the activation class, and applies the activation
+ * (e.g. ThresholdsActivation or ChannelWiseOperation for a requantization to the average) while the last pixel
+ * of every image streams in, producing NumChannels/PECount output words per image.
+ *
+ * \tparam ImgDim       Width and Heigth of the Input Feature Map (assumed square)
+ * \tparam NumChannels  Number of Input Feature Maps
+ * \tparam ActType      DataType of the input activation
+ * \tparam PECount      Number of channels processed in parallel
+ * \tparam AccType      Datatype of the accumulation
+ * \tparam OutType      Datatype of the output (as generated by the activation)
+ * \tparam TA           DataType of the activation class (e.g. thresholds) - safely deducible from the paramaters
+ *
+ * \param in            Input stream
+ * \param out           Output stream
+ * \param activation    Activation class applied to the accumulated values
+ * \param numReps       Number of time the function has to be repeatedly executed (e.g. number of images)
+ *
+ */
+template<
+    unsigned int ImgDim,
+    unsigned int NumChannels,
+    typename ActType,
+    unsigned int PECount,
+    typename AccType,
+    typename OutType,
+    typename TA>
+void GlobalAccPool_Batch(hls::stream<ap_uint<PECount * ActType::width> > & in,
+        hls::stream<ap_uint<PECount * OutType::width> > & out, TA const &activation, const unsigned int numReps) {
+  static_assert(NumChannels % PECount == 0, "");
+  constexpr unsigned int NF = NumChannels / PECount;
+  constexpr unsigned int TOTAL_FOLD = ImgDim * ImgDim * NF;
+  AccType accumulators[PECount][NF];
+  // the cost model accounts for the accumulators and one cycle per input word
+  static_assert(cost::GlobalAccPool_Batch<ImgDim, NumChannels, PECount, AccType::width>::buffer_bits ==
+                PECount * NF * AccType::width, "");
+  static_assert(cost::GlobalAccPool_Batch<ImgDim, NumChannels, PECount, AccType::width>::cycles_per_image >=
+                ImgDim * ImgDim * NF, "");
+#pragma HLS ARRAY_PARTITION variable=accumulators complete dim=1
+#pragma HLS bind_storage variable=accumulators type=RAM_2P impl=LUTRAM
+
+  for(unsigned int reps = 0; reps < numReps; reps++) {
+    unsigned int pixel = 0;
+    unsigned int nf = 0;
+    for(unsigned int i = 0; i < TOTAL_FOLD; i++) {
+#pragma HLS pipeline style=flp II=1
+      ap_uint<PECount * ActType::width> const  inElem = in.read();
+      ap_uint<PECount * OutType::width> outElem;
+      for(unsigned int pe = 0; pe < PECount; pe++) {
+#pragma HLS UNROLL
+        ActType const  val = inElem((pe+1) * ActType::width - 1, pe * ActType::width);
+        AccType const  acc = (pixel == 0? AccType(activation.init(nf, pe)) : accumulators[pe][nf]) + val;
+        accumulators[pe][nf] = acc;
+        OutType const  result = activation.activate(nf, pe, acc);
+        outElem((pe+1) * OutType::width - 1, pe * OutType::width) = result;
+      }
+      // the last pixel completes the accumulation of its channels
+      if(pixel == ImgDim * ImgDim - 1) {
+        out.write(outElem);
+      }
+      if(++nf == NF) {
+        nf = 0;
+        pixel++;
+      }
+    }
+  }
+}
+
+/**
+ * \brief   Global accumulate-pool without output activation, see GlobalAccPool_Batch
+ *
+ * \tparam ImgDim       Width and Heigth of the Input Feature Map (assumed square)
+ * \tparam NumChannels  Number of Input Feature Maps
+ * \tparam ActType      DataType of the input activation
+ * \tparam PECount      Number of channels processed in parallel
+ * \tparam AccType      Datatype of the accumulation (e.g. output)
+ *
+ * \param in            Input stream
+ * \param out           Output stream
+ * \param numReps       Number of time the function has to be repeatedly executed (e.g. number of images)
+ *
+ */
+template<
+    unsigned int ImgDim,
+    unsigned int NumChannels,
+    typename ActType,
+    unsigned int PECount,
+    typename AccType>
+void GlobalAccPool_Batch(hls::stream<ap_uint<PECount * ActType::width> > & in,
+        hls::stream<ap_uint<PECount * AccType::width> > & out, const unsigned int numReps) {
+#pragma HLS INLINE
+  GlobalAccPool_Batch<ImgDim, NumChannels, ActType, PECount, AccType, AccType>(in, out, PassThroughActivation<AccType>(), numReps);
+}
+
 
 
 /**
@@ -531,6 +827,149 @@ void LabelSelect_Batch(hls::stream<ap_uint<PECount * In_T::width> > & in,
 }
 
 
+/**
+ * \brief   LabelSelect_Tree_Batch - returns labels of top-NumTop in stream, with a pipelined top-K unit
+ *
+ * Drop-in replacement of LabelSelect_Batch for large PECount and NumTop. Every input word is first sorted by a
+ * bitonic sorting network, outside of the loop-carried path. The running top values are then merged with the
+ * sorted inputs by a bitonic merge, so the critical path of the recurrence only depends on log2(NumTop) instead
+ * of PECount*NumTop chained comparators. Equal values are ranked by ascending label, as in LabelSelect_Batch.
+ *
+ * \tparam NumClasses   Number of classes of the dataset
+ * \tparam PECount      Number of inputs to be processed in parallel
+ * \tparam NumTop       Number of top classes to be selected in output
+ * \tparam In_T         Datatype of the input
+ * \tparam Out_T        Datatype of the output
+ *
+ * \param in            Input stream
+ * \param out           Output stream
+ * \param numReps       Number of times the function has to be repeatedly executed (e.g. number of images)
+ *
+ */
+template<
+    // tensor size parameters
+    unsigned int NumClasses,
+    unsigned int PECount,
+    unsigned int NumTop,
+    typename In_T,
+    typename Out_T>
+void LabelSelect_Tree_Batch(hls::stream<ap_uint<PECount * In_T::width> > & in,
+        hls::stream<Out_T> & out, const unsigned int numReps) {
+
+  // Check that classes, aka. labels / indeces, can be encoded as non-negative outputs
+  static_assert(clog2(NumClasses) <= Out_T::width - Out_T::sign_flag, "");
+  static_assert(NumClasses % PECount == 0, "");
+  static_assert(NumTop <= NumClasses, "");
+  static In_T const  In_T_MIN_VAL = (In_T(-1)<0)? 1<<(In_T::width-1) : 0;
+
+  // networks on power-of-two sizes, padded with entries ranked below all classes
+  constexpr unsigned  LOG_SORT = clog2(PECount);
+  constexpr unsigned  SORT = 1 << LOG_SORT;
+  constexpr unsigned  LOG_TOP = clog2(NumTop);
+  constexpr unsigned  TOP = 1 << LOG_TOP;
+  constexpr unsigned  CANDIDATES = SORT > TOP? SORT : TOP;
+  typedef ap_uint<clog2(NumClasses) + 1>  Label_T;
+  Label_T const  PAD_LABEL = ~Label_T(0);
+
+  // Array of encountered top values
+  //  - maintains (topval[i], toplabels[i]) ranked before (topval[i+1], toplabels[i+1])
+  In_T topval[TOP];
+#pragma HLS ARRAY_PARTITION variable=topval complete dim=1
+  Label_T toplabels[TOP];
+#pragma HLS ARRAY_PARTITION variable=toplabels complete dim=1
+
+  for(unsigned int reps=0; reps<numReps; reps++){
+    for(unsigned int topx=0; topx<TOP; topx++){
+#pragma HLS UNROLL
+      topval   [topx] = In_T_MIN_VAL;
+      toplabels[topx] = PAD_LABEL;
+    }
+    for(unsigned int block=0; block<(NumClasses/PECount); block++){
+#pragma HLS pipeline style=flp II=1
+      ap_uint<PECount * In_T::width> const  inval = in.read();
+
+      // Extract individual inputs
+      In_T  val[CANDIDATES];
+#pragma HLS ARRAY_PARTITION variable=val complete dim=1
+      Label_T  label[CANDIDATES];
+#pragma HLS ARRAY_PARTITION variable=label complete dim=1
+      for(unsigned int elem=0; elem<CANDIDATES; elem++){
+#pragma HLS UNROLL
+        if(elem < PECount) {
+          unsigned const  lowBit = elem * In_T::width;
+          unsigned const  highBit = (elem+1) * In_T::width - 1;
+          val  [elem] = inval(highBit,lowBit);
+          label[elem] = block * PECount + elem;
+        }
+        else {
+          val  [elem] = In_T_MIN_VAL;
+          label[elem] = PAD_LABEL;
+        }
+      }
+
+      // Bitonic sort of the inputs, highest ranked first
+      for(unsigned  s = 0; s < LOG_SORT; s++) {
+#pragma HLS UNROLL
+        for(unsigned  t = 0; t <= s; t++) {
+#pragma HLS UNROLL
+          unsigned const  dist = 1 << (s - t);
+          for(unsigned  i = 0; i < SORT; i++) {
+#pragma HLS UNROLL
+            unsigned const  l = i ^ dist;
+            if(l > i) {
+              bool const  desc = (i & (2 << s)) == 0;
+              bool const  l_first = (val[l] > val[i]) || ((val[l] == val[i]) && (label[l] < label[i]));
+              if(l_first == desc) {
+                In_T const  v = val[i];
+                val[i] = val[l];
+                val[l] = v;
+                Label_T const  lb = label[i];
+                label[i] = label[l];
+                label[l] = lb;
+              }
+            }
+          }
+        }
+      }
+
+      // Merge with the current tops: the better of each mirrored pair forms a bitonic sequence
+      for(unsigned  i = 0; i < TOP; i++) {
+#pragma HLS UNROLL
+        unsigned const  m = TOP - 1 - i;
+        bool const  take = (val[m] > topval[i]) || ((val[m] == topval[i]) && (label[m] < toplabels[i]));
+        if(take) {
+          topval   [i] = val  [m];
+          toplabels[i] = label[m];
+        }
+      }
+      for(unsigned  t = 0; t < LOG_TOP; t++) {
+#pragma HLS UNROLL
+        unsigned const  dist = TOP >> (t + 1);
+        for(unsigned  i = 0; i < TOP; i++) {
+#pragma HLS UNROLL
+          unsigned const  l = i ^ dist;
+          if(l > i) {
+            if((topval[l] > topval[i]) || ((topval[l] == topval[i]) && (toplabels[l] < toplabels[i]))) {
+              In_T const  v = topval[i];
+              topval[i] = topval[l];
+              topval[l] = v;
+              Label_T const  lb = toplabels[i];
+              toplabels[i] = toplabels[l];
+              toplabels[l] = lb;
+            }
+          }
+        }
+      }
+    }
+
+    // Output - index of highest value first
+    for(unsigned int topx = 0; topx < NumTop; topx++){
+      out.write(toplabels[topx]);
+    }
+  }
+}
+
+
 /**
  * \brief Pool_batch function
  *
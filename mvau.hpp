@@ -54,7 +54,9 @@
 #include "hls_stream.h"
 
 #include "mac.hpp"
+#include "activations.hpp"
 #include "interpret.hpp"
+#include "costmodel.hpp"
 #include "weights.hpp"
 
 /**
@@ -112,6 +114,10 @@ void Matrix_Vector_Activate_Batch(hls::stream<TI> &in,
 
   decltype(activation.init(0,0))  accu[MMV][PE];
 #pragma HLS ARRAY_PARTITION variable=accu complete dim=0
+  static_assert(!FINN_HLSLIB_CHECK_ACCU_WIDTH || mac_accumulator_fits<decltype(activation.init(0,0)), MatrixW,
+      mac_weight_t<decltype(TWeightI()(weights.weights(0)[0]))>,
+      mac_input_t<decltype(TSrcI()(std::declval<TI const&>(), 0))>>(),
+    "Accumulator is too narrow for MatrixW products of the given operand types.");
 
   unsigned  nf   = 0;
   unsigned  sf   = 0;
@@ -120,6 +126,11 @@ void Matrix_Vector_Activate_Batch(hls::stream<TI> &in,
   // everything merged into a common iteration space (one "big" loop instead
   // of smaller nested loops) to get the pipelinening the way we want
   unsigned const TOTAL_FOLD = NF * SF;
+  // the cost model accounts for the weights, the input buffer and one SIMD x PE tile of MACs per cycle
+  typedef cost::Matrix_Vector_Activate_Batch<MatrixW, MatrixH, SIMD, PE, MMV, cost::weight_bits<TW>::value,
+                                             cost::element_bits<TI>::value / (SIMD * MMV)>  KernelCost;
+  static_assert(KernelCost::buffer_bits == MatrixW * MatrixH * cost::weight_bits<TW>::value + SF * cost::element_bits<TI>::value, "");
+  static_assert(KernelCost::cycles_per_image == TOTAL_FOLD, "");
   for(unsigned  i = 0; i < reps * TOTAL_FOLD; i++) {
 #pragma HLS pipeline style=flp II=1
     TI  inElem;
@@ -179,18 +190,365 @@ void Matrix_Vector_Activate_Batch(hls::stream<TI> &in,
   }
 }
 
+/**
+ * \brief Matrix vector activate function without activation
+ *
+ * Outputs the accumulated results through a MacPassThroughActivation, i.e. in the smallest accumulator
+ * that holds MatrixW products of the weight and input types. TDstI has to interpret the output with that
+ * type, e.g. Slice<MacAccumulator<MatrixW, TWeight, TInput>::type>.
+ *
+ * \tparam MatrixW    Width of the input matrix
+ * \tparam MatrixH    Heigth of the input matrix
+ * \tparam SIMD       Number of input columns computed in parallel
+ * \tparam PE         Number of output rows computed in parallel
+ * \tparam MMV        Number of output pixels computed in parallel
+ * \tparam TSrcI      DataType of the input activation (as used in the MAC)
+ * \tparam TDstI      DataType of the output activation (the inferred accumulator)
+ * \tparam TWeightI   DataType of the weights and how to access them in the array
+ * \tparam TI         DataType of the input stream - safely deducible from the paramaters
+ * \tparam TO         DataType of the output stream - safely deducible from the paramaters
+ * \tparam TW         DataType of the weights matrix - safely deducible from the paramaters
+ * \tparam R          Datatype for the resource used for FPGA implementation of the MAC  - safely deducible from the paramaters
+ *
+ * \param in          Input stream
+ * \param out         Output stream
+ * \param weights     Weights matrix (currently supports BinaryWeights or FixedPointWeights)
+ * \param reps        Number of time the function has to be repeatedly executed (e.g. number of images)
+ * \param r           Resource type for the hardware implementation of the MAC block
+ */
+template<
+  unsigned MatrixW, unsigned MatrixH, unsigned SIMD, unsigned PE, unsigned MMV,
+  typename TSrcI = Identity, typename TDstI = Identity, typename TWeightI = Identity,
+  typename TI, typename TO, typename TW, typename R
+>
+void Matrix_Vector_Activate_Batch(hls::stream<TI> &in,
+				  hls::stream<TO> &out,
+				  TW  const &weights,
+				  int const  reps,
+				  R const &r) {
+#pragma HLS inline
+  using  TWgt = mac_weight_t<decltype(TWeightI()(weights.weights(0)[0]))>;
+  using  TInp = mac_input_t<decltype(TSrcI()(std::declval<TI const&>(), 0))>;
+  Matrix_Vector_Activate_Batch<MatrixW, MatrixH, SIMD, PE, MMV, TSrcI, TDstI, TWeightI>
+    (in, out, weights, MacPassThroughActivation<MatrixW, TWgt, TInp>(), reps, r);
+}
+
+
+/**
+ * \brief Matrix vector activate function skipping zero weight tiles
+ *
+ * Functionally equivalent to Matrix_Vector_Activate_Batch with the same input and output
+ * ordering, for a block-sparse weight matrix that only stores its non-zero SIMD x PE tiles
+ * (see SparseFixedPointWeights). The first neuron fold is dense: it has to take all SF input
+ * vectors from the stream into the buffer, one per cycle, so it spends SF cycles whatever its
+ * sparsity and only accumulates in the cycles of its stored tiles. Every further neuron fold
+ * only spends one cycle per stored tile (and a single cycle if it has none), replaying the
+ * required input vectors from the buffer. The resulting cycles per input vector are taken
+ * from weights.cycles().
+ *
+ * \tparam MatrixW    Width of the input matrix
+ * \tparam MatrixH    Heigth of the input matrix
+ * \tparam SIMD       Number of input columns computed in parallel
+ * \tparam PE         Number of output rows computed in parallel
+ * \tparam MMV        Number of output pixels computed in parallel
+ * \tparam TSrcI      DataType of the input activation (as used in the MAC)
+ * \tparam TDstI      DataType of the output activation (as generated by the activation)
+ * \tparam TWeightI   DataType of the weights and how to access them in the array
+ * \tparam TI         DataType of the input stream - safely deducible from the paramaters
+ * \tparam TO         DataType of the output stream - safely deducible from the paramaters
+ * \tparam TW         DataType of the weights matrix - safely deducible from the paramaters
+ * \tparam TA         DataType of the activation class (e.g. thresholds) - safely deducible from the paramaters
+ * \tparam R          Datatype for the resource used for FPGA implementation of the MAC  - safely deducible from the paramaters
+ *
+ * \param in          Input stream
+ * \param out         Output stream
+ * \param weights     Sparse weights matrix (currently supports SparseBinaryWeights or SparseFixedPointWeights)
+ * \param activation  Activation class
+ * \param reps        Number of time the function has to be repeatedly executed (e.g. number of images)
+ * \param r           Resource type for the hardware implementation of the MAC block
+ */
+template<
+  unsigned MatrixW, unsigned MatrixH, unsigned SIMD, unsigned PE, unsigned MMV, 
+  typename TSrcI = Identity, typename TDstI = Identity, typename TWeightI = Identity,
+  typename TI, typename TO, typename TW, typename TA, typename R
+>
+void Matrix_Vector_Activate_Sparse_Batch(hls::stream<TI> &in,
+				  hls::stream<TO> &out,
+				  TW  const &weights,
+				  TA  const &activation,
+				  int const  reps,
+				  R const &r) {
+
+  // how many different rows each neuron will compute
+  // alternatively: number of vertical matrix chunks
+  unsigned const  NF = MatrixH / PE;
+
+  // how many synapse groups each row is split into
+  // alternatively: number of horizontal matrix chunks
+  unsigned const  SF = MatrixW / SIMD;
+
+  // input vector buffers
+  TI  inputBuf[SF];
+#pragma HLS ARRAY_PARTITION variable=inputBuf complete dim=0
+
+
+  decltype(activation.init(0,0))  accu[MMV][PE];
+#pragma HLS ARRAY_PARTITION variable=accu complete dim=0
+  static_assert(!FINN_HLSLIB_CHECK_ACCU_WIDTH || mac_accumulator_fits<decltype(activation.init(0,0)), MatrixW,
+      mac_weight_t<decltype(TWeightI()(weights.weights(0)[0]))>,
+      mac_input_t<decltype(TSrcI()(std::declval<TI const&>(), 0))>>(),
+    "Accumulator is too narrow for MatrixW products of the given operand types.");
+
+  // cycles per input vector, fixed by the sparsity pattern
+  unsigned const  cycles = weights.cycles();
+
+  unsigned  nf    = 0;
+  unsigned  sf    = 0;
+  unsigned  tile  = 0; // next stored tile to be processed
+  bool      first = true;
+
+  // everything merged into a common iteration space (one "big" loop instead
+  // of smaller nested loops) to get the pipelinening the way we want
+  for(unsigned  i = 0; i < reps * cycles; i++) {
+#pragma HLS pipeline style=flp II=1
+    unsigned const  end = weights.offset(nf+1);
+    TI  inElem;
+    bool  valid;
+    bool  last;
+    if(nf == 0) {
+      // read input from stream
+      inElem = in.read();
+      // store in appropriate buffer for reuse
+      inputBuf[sf] = inElem;
+      valid = (tile < end) && (weights.column(tile) == sf);
+      last  = sf == SF-1;
+    }
+    else {
+      // reuse buffered input of the next stored tile
+      valid  = tile < end;
+      inElem = inputBuf[valid? weights.column(tile) : 0];
+      last   = tile+1 >= end;
+    }
+
+    // Threshold Initialisation
+    if(first) {
+      for(unsigned  pe = 0; pe < PE; pe++) {
+#pragma HLS UNROLL
+        for(unsigned mmv = 0; mmv < MMV; mmv++) {
+#pragma HLS UNROLL
+          accu[mmv][pe] = activation.init(nf, pe);
+        }
+      }
+    }
+
+    // compute matrix-vector product for each processing element
+    if(valid) {
+      auto const &w = weights.weights(tile);
+      for(unsigned  pe = 0; pe < PE; pe++) {
+#pragma HLS UNROLL
+        auto const  wgt = TWeightI()(w[pe]);
+        for (unsigned mmv = 0; mmv < MMV; mmv++){
+          auto const  act = TSrcI()(inElem, mmv);
+          accu[mmv][pe] = mac<SIMD>(accu[mmv][pe], wgt, act, r, mmv);
+        }
+      }
+      ++tile;
+    }
+
+    // keep track of which folded synapse/neuron we are processing
+    ++sf;
+    first = last;
+    if(last) {
+      // produce output and clear accumulators
+      auto  outElem = TDstI().template operator()<TO>();
+      for (unsigned  pe = 0; pe < PE; pe++) {
+#pragma HLS UNROLL
+        for (unsigned mmv = 0; mmv < MMV; mmv++){
+#pragma HLS UNROLL
+          outElem(pe,mmv,1) = activation.activate(nf, pe, accu[mmv][pe]);
+        }
+      }
+      out.write(outElem);
+      // next folded neuron or image
+      sf = 0;
+      if(++nf == NF) {
+	    nf   = 0;
+	    tile = 0;
+      }
+    }
+  }
+}
+
+
+/**
+ * \brief Matrix vector activate function with input prefetching
+ *
+ * Functionally equivalent to Matrix_Vector_Activate_Batch. The input vectors are
+ * double-buffered: once the current vector is completely buffered, the next one
+ * is read into the second buffer with non-blocking reads while the current vector
+ * is replayed for the remaining neuron folds. Words not prefetched by then are
+ * read blocking when they are first needed. This spreads the consumption of the
+ * input stream over all NF*SF iterations instead of only the first SF ones, which
+ * reduces upstream stalls and the FIFO depth required in front of the layer.
+ *
+ * \tparam MatrixW    Width of the input matrix
+ * \tparam MatrixH    Heigth of the input matrix
+ * \tparam SIMD       Number of input columns computed in parallel
+ * \tparam PE         Number of output rows computed in parallel
+ * \tparam MMV        Number of output pixels computed in parallel
+ * \tparam TSrcI      DataType of the input activation (as used in the MAC)
+ * \tparam TDstI      DataType of the output activation (as generated by the activation)
+ * \tparam TWeightI   DataType of the weights and how to access them in the array
+ * \tparam TS         DataType of the input stream (hls::stream or a class with the same read and read_nb) - safely deducible from the paramaters
+ * \tparam TO         DataType of the output stream - safely deducible from the paramaters
+ * \tparam TW         DataType of the weights matrix - safely deducible from the paramaters
+ * \tparam TA         DataType of the activation class (e.g. thresholds) - safely deducible from the paramaters
+ * \tparam R          Datatype for the resource used for FPGA implementation of the MAC  - safely deducible from the paramaters
+ *
+ * \param in          Input stream
+ * \param out         Output stream
+ * \param weights     Weights matrix (currently supports BinaryWeights or FixedPointWeights)
+ * \param activation  Activation class
+ * \param reps        Number of time the function has to be repeatedly executed (e.g. number of images)
+ * \param r           Resource type for the hardware implementation of the MAC block
+ */
+template<
+  unsigned MatrixW, unsigned MatrixH, unsigned SIMD, unsigned PE, unsigned MMV, 
+  typename TSrcI = Identity, typename TDstI = Identity, typename TWeightI = Identity,
+  typename TS, typename TO, typename TW, typename TA, typename R
+>
+void Matrix_Vector_Activate_Prefetch_Batch(TS &in,
+				  hls::stream<TO> &out,
+				  TW  const &weights,
+				  TA  const &activation,
+				  int const  reps,
+				  R const &r) {
+
+  // how many different rows each neuron will compute
+  // alternatively: number of vertical matrix chunks
+  unsigned const  NF = MatrixH / PE;
+
+  // how many synapse groups each row is split into
+  // alternatively: number of horizontal matrix chunks
+  unsigned const  SF = MatrixW / SIMD;
+
+  // element type of the input stream
+  typedef typename std::decay<decltype(in.read())>::type  TI;
+
+  // ping-pong input vector buffers
+  TI  inputBuf[2][SF];
+#pragma HLS ARRAY_PARTITION variable=inputBuf complete dim=1
+
+
+  decltype(activation.init(0,0))  accu[MMV][PE];
+#pragma HLS ARRAY_PARTITION variable=accu complete dim=0
+  static_assert(!FINN_HLSLIB_CHECK_ACCU_WIDTH || mac_accumulator_fits<decltype(activation.init(0,0)), MatrixW,
+      mac_weight_t<decltype(TWeightI()(weights.weights(0)[0]))>,
+      mac_input_t<decltype(TSrcI()(std::declval<TI const&>(), 0))>>(),
+    "Accumulator is too narrow for MatrixW products of the given operand types.");
+
+  unsigned  nf   = 0;
+  unsigned  sf   = 0;
+  unsigned  tile = 0; // invariant: tile = nf*SF + sf
+  unsigned  cur   = 0; // buffer holding the current vector
+  unsigned  avail = 0; // number of words of the current vector in inputBuf[cur]
+  unsigned  fill  = 0; // number of words of the next vector in inputBuf[1-cur]
+  int       rep   = 0;
+
+  // everything merged into a common iteration space (one "big" loop instead
+  // of smaller nested loops) to get the pipelinening the way we want
+  unsigned const TOTAL_FOLD = NF * SF;
+  // the cost model accounts for the weights, both input buffers and one SIMD x PE tile of MACs per cycle
+  typedef cost::Matrix_Vector_Activate_Prefetch_Batch<MatrixW, MatrixH, SIMD, PE, MMV, cost::weight_bits<TW>::value,
+                                                      cost::element_bits<TI>::value / (SIMD * MMV)>  KernelCost;
+  static_assert(KernelCost::buffer_bits == MatrixW * MatrixH * cost::weight_bits<TW>::value + 2 * SF * cost::element_bits<TI>::value, "");
+  static_assert(KernelCost::cycles_per_image == TOTAL_FOLD, "");
+  for(unsigned  i = 0; i < reps * TOTAL_FOLD; i++) {
+#pragma HLS pipeline style=flp II=1
+    TI  inElem;
+    if(sf < avail) {
+      // reuse buffered (or prefetched) input
+      inElem = inputBuf[cur][sf];
+      // prefetch the next vector if data is available, only once the current
+      // vector is complete as the stream still delivers its words otherwise
+      TI  nextElem;
+      if((avail == SF) && (rep+1 < reps) && (fill < SF) && in.read_nb(nextElem)) {
+        inputBuf[1-cur][fill++] = nextElem;
+      }
+    }
+    else {
+      // read input from stream
+      inElem = in.read();
+      // store in appropriate buffer for reuse
+      inputBuf[cur][sf] = inElem;
+      avail++;
+    }
+
+    // Threshold Initialisation
+    if(sf == 0) {
+      for(unsigned  pe = 0; pe < PE; pe++) {
+#pragma HLS UNROLL
+        for(unsigned mmv = 0; mmv < MMV; mmv++) {
+#pragma HLS UNROLL
+          accu[mmv][pe] = activation.init(nf, pe);
+        }
+      }
+    }
+
+    // compute matrix-vector product for each processing element
+    auto const &w = weights.weights(tile);
+    for(unsigned  pe = 0; pe < PE; pe++) {
+#pragma HLS UNROLL
+      auto const  wgt = TWeightI()(w[pe]);
+      for (unsigned mmv = 0; mmv < MMV; mmv++){
+        auto const  act = TSrcI()(inElem, mmv);
+        accu[mmv][pe] = mac<SIMD>(accu[mmv][pe], wgt, act, r, mmv);
+      }
+    }
+
+    // keep track of which folded synapse/neuron we are processing
+    ++tile;
+    if(++sf == SF) {
+      // produce output and clear accumulators
+      auto  outElem = TDstI().template operator()<TO>();
+      for (unsigned  pe = 0; pe < PE; pe++) {
+#pragma HLS UNROLL
+        for (unsigned mmv = 0; mmv < MMV; mmv++){
+#pragma HLS UNROLL
+          outElem(pe,mmv,1) = activation.activate(nf, pe, accu[mmv][pe]);
+        }
+      }
+      out.write(outElem);
+      // next folded neuron or image
+      sf = 0;
+      if(++nf == NF) {
+	    nf   = 0;
+	    tile = 0;
+	    // swap buffers
+	    cur   = 1-cur;
+	    avail = fill;
+	    fill  = 0;
+	    rep++;
+      }
+    }
+  }
+}
+
 
 /**
  * \brief Matrix vector activate function with streaming weights
  *
  * The function performs the multiplication between a weigth matrix, presnted as an input stream, and the input activation vector,
- * accumulating the results and then applying an activation function on the accumulated result. Does not support MMV.
+ * accumulating the results and then applying an activation function on the accumulated result.
+ * Every weight tile read from the weight stream is applied to all MMV input pixels so that the
+ * required weight bandwidth is divided by MMV.
  *
  * 
  * \tparam MatrixW    Width of the input matrix
  * \tparam MatrixH    Heigth of the input matrix
  * \tparam SIMD       Number of input columns computed in parallel
  * \tparam PE         Number of output rows computed in parallel
+ * \tparam MMV        Number of output pixels computed in parallel
  * \tparam TSrcI      DataType of the input activation (as used in the MAC)
  * \tparam TDstI      DataType of the output activation (as generated by the activation)
  * \tparam TWeightI   DataType of the weights and how to access them in the array
@@ -208,7 +566,7 @@ void Matrix_Vector_Activate_Batch(hls::stream<TI> &in,
  * \param r           Resource type for the hardware implementation of the MAC block
  */
 template<
-  unsigned MatrixW, unsigned MatrixH, unsigned SIMD, unsigned PE, 
+  unsigned MatrixW, unsigned MatrixH, unsigned SIMD, unsigned PE, unsigned MMV,
   typename TSrcI = Identity, typename TDstI = Identity, typename TWeightI = Identity, typename TW,
   typename TI, typename TO, typename TA, typename R
 >
@@ -231,8 +589,12 @@ void Matrix_Vector_Activate_Stream_Batch(hls::stream<TI> &in,
   TI  inputBuf[SF];
 #pragma HLS ARRAY_PARTITION variable=inputBuf complete dim=1
   // accumulators
-  decltype(activation.init(0,0))  accu[1][PE];
+  decltype(activation.init(0,0))  accu[MMV][PE];
 #pragma HLS ARRAY_PARTITION variable=accu complete dim=0
+  static_assert(!FINN_HLSLIB_CHECK_ACCU_WIDTH || mac_accumulator_fits<decltype(activation.init(0,0)), MatrixW,
+      mac_weight_t<decltype(TWeightI()(std::declval<std::array<TW, SIMD> const&>()))>,
+      mac_input_t<decltype(TSrcI()(std::declval<TI const&>(), 0))>>(),
+    "Accumulator is too narrow for MatrixW products of the given operand types.");
   // unpacked and packed buffers for weight stream
   Weights_Tile<SIMD, TW, PE > w;
 #pragma HLS ARRAY_PARTITION variable=w.m_weights complete dim=0
@@ -246,6 +608,11 @@ void Matrix_Vector_Activate_Stream_Batch(hls::stream<TI> &in,
   // everything merged into a common iteration space (one "big" loop instead
   // of smaller nested loops) to get the pipelinening the way we want
   unsigned const TOTAL_FOLD = NF * SF;
+  // the cost model accounts for the input buffer and one SIMD x PE tile of MACs per cycle
+  typedef cost::Matrix_Vector_Activate_Stream_Batch<MatrixW, MatrixH, SIMD, PE, MMV,
+                                                    cost::element_bits<TI>::value / (SIMD * MMV)>  KernelCost;
+  static_assert(KernelCost::buffer_bits == SF * cost::element_bits<TI>::value, "");
+  static_assert(KernelCost::cycles_per_image == TOTAL_FOLD, "");
   for(unsigned  i = 0; i < reps * TOTAL_FOLD; i++) {
 #pragma HLS pipeline style=flp II=1
     TI  inElem;
@@ -261,7 +628,7 @@ void Matrix_Vector_Activate_Stream_Batch(hls::stream<TI> &in,
       inElem = inputBuf[sf];
     }
 
-    // read from the parameter stream
+    // read from the parameter stream, once for all MMV pixels
     W_packed = weight.read();
     for (unsigned pe = 0; pe < PE; pe++) {
 #pragma HLS UNROLL
@@ -272,17 +639,22 @@ void Matrix_Vector_Activate_Stream_Batch(hls::stream<TI> &in,
     if(sf == 0) {
       for(unsigned pe = 0; pe < PE; pe++) {
 #pragma HLS UNROLL
-      accu[0][pe] = activation.init(nf, pe);
+        for(unsigned mmv = 0; mmv < MMV; mmv++) {
+#pragma HLS UNROLL
+          accu[mmv][pe] = activation.init(nf, pe);
+        }
       }
     }
 
     // compute matrix-vector product for each processing element
     for(unsigned  pe = 0; pe < PE; pe++) {
 #pragma HLS UNROLL
-      auto const  act = TSrcI()(inElem, 0);
       auto const  wgt = TWeightI()(w[pe]);
-      //auto const  wgt = w[pe];
-      accu[0][pe] = mac<SIMD>(accu[0][pe], wgt, act, r, 0);
+      for (unsigned mmv = 0; mmv < MMV; mmv++){
+#pragma HLS UNROLL
+        auto const  act = TSrcI()(inElem, mmv);
+        accu[mmv][pe] = mac<SIMD>(accu[mmv][pe], wgt, act, r, mmv);
+      }
     }
 
     // keep track of which folded synapse/neuron we are processing
@@ -292,8 +664,11 @@ void Matrix_Vector_Activate_Stream_Batch(hls::stream<TI> &in,
       auto  outElem = TDstI().template operator()<TO>();
       for (unsigned  pe = 0; pe < PE; pe++) {
 #pragma HLS UNROLL
-      outElem(pe,0,1) = activation.activate(nf, pe, accu[0][pe]);
-          }
+        for (unsigned mmv = 0; mmv < MMV; mmv++){
+#pragma HLS UNROLL
+          outElem(pe,mmv,1) = activation.activate(nf, pe, accu[mmv][pe]);
+        }
+      }
 
       out.write(outElem);
 
@@ -307,4 +682,87 @@ void Matrix_Vector_Activate_Stream_Batch(hls::stream<TI> &in,
   }
 }
 
+/**
+ * \brief Matrix vector activate function with streaming weights, single output pixel
+ *
+ * Convenience overload keeping the original interface without the MMV template parameter.
+ * It is equivalent to the MMV variant instantiated with MMV = 1.
+ *
+ * \tparam MatrixW    Width of the input matrix
+ * \tparam MatrixH    Heigth of the input matrix
+ * \tparam SIMD       Number of input columns computed in parallel
+ * \tparam PE         Number of output rows computed in parallel
+ * \tparam TSrcI      DataType of the input activation (as used in the MAC)
+ * \tparam TDstI      DataType of the output activation (as generated by the activation)
+ * \tparam TWeightI   DataType of the weights and how to access them in the array
+ * \tparam TW         DataType of the weights (as used in the MAC) - not deducible from the paramaters
+ * \tparam TI         DataType of the input stream - safely deducible from the paramaters
+ * \tparam TO         DataType of the output stream - safely deducible from the paramaters
+ * \tparam TA         DataType of the activation class (e.g. thresholds) - safely deducible from the paramaters
+ * \tparam R          Datatype for the resource used for FPGA implementation of the MAC  - safely deducible from the paramaters
+ *
+ * \param in          Input stream
+ * \param out         Output stream
+ * \param weight      Weight stream (currently supports BinaryWeights or FixedPointWeights)
+ * \param activation  Activation class
+ * \param reps        Number of time the function has to be repeatedly executed (e.g. number of images)
+ * \param r           Resource type for the hardware implementation of the MAC block
+ */
+template<
+  unsigned MatrixW, unsigned MatrixH, unsigned SIMD, unsigned PE,
+  typename TSrcI = Identity, typename TDstI = Identity, typename TWeightI = Identity, typename TW,
+  typename TI, typename TO, typename TA, typename R
+>
+void Matrix_Vector_Activate_Stream_Batch(hls::stream<TI> &in,
+          hls::stream<TO> &out,
+          hls::stream<ap_uint<PE*SIMD*TW::width>> &weight,
+          TA  const &activation,
+          int const  reps,
+          R const &r) {
+#pragma HLS inline
+  Matrix_Vector_Activate_Stream_Batch<MatrixW, MatrixH, SIMD, PE, 1, TSrcI, TDstI, TWeightI, TW>
+    (in, out, weight, activation, reps, r);
+}
+
+/**
+ * \brief Matrix vector activate function with streaming weights, single output pixel, without activation
+ *
+ * Outputs the accumulated results in the smallest accumulator that holds MatrixW products of the weight
+ * and input types, see the Matrix_Vector_Activate_Batch overload without activation.
+ *
+ * \tparam MatrixW    Width of the input matrix
+ * \tparam MatrixH    Heigth of the input matrix
+ * \tparam SIMD       Number of input columns computed in parallel
+ * \tparam PE         Number of output rows computed in parallel
+ * \tparam TSrcI      DataType of the input activation (as used in the MAC)
+ * \tparam TDstI      DataType of the output activation (the inferred accumulator)
+ * \tparam TWeightI   DataType of the weights and how to access them in the array
+ * \tparam TW         DataType of the weights (as used in the MAC) - not deducible from the paramaters
+ * \tparam TI         DataType of the input stream - safely deducible from the paramaters
+ * \tparam TO         DataType of the output stream - safely deducible from the paramaters
+ * \tparam R          Datatype for the resource used for FPGA implementation of the MAC  - safely deducible from the paramaters
+ *
+ * \param in          Input stream
+ * \param out         Output stream
+ * \param weight      Weight stream (currently supports BinaryWeights or FixedPointWeights)
+ * \param reps        Number of time the function has to be repeatedly executed (e.g. number of images)
+ * \param r           Resource type for the hardware implementation of the MAC block
+ */
+template<
+  unsigned MatrixW, unsigned MatrixH, unsigned SIMD, unsigned PE,
+  typename TSrcI = Identity, typename TDstI = Identity, typename TWeightI = Identity, typename TW,
+  typename TI, typename TO, typename R
+>
+void Matrix_Vector_Activate_Stream_Batch(hls::stream<TI> &in,
+          hls::stream<TO> &out,
+          hls::stream<ap_uint<PE*SIMD*TW::width>> &weight,
+          int const  reps,
+          R const &r) {
+#pragma HLS inline
+  using  TWgt = mac_weight_t<decltype(TWeightI()(std::declval<std::array<TW, SIMD> const&>()))>;
+  using  TInp = mac_input_t<decltype(TSrcI()(std::declval<TI const&>(), 0))>;
+  Matrix_Vector_Activate_Stream_Batch<MatrixW, MatrixH, SIMD, PE, 1, TSrcI, TDstI, TWeightI, TW>
+    (in, out, weight, MacPassThroughActivation<MatrixW, TWgt, TInp>(), reps, r);
+}
+
 #endif
@@ -50,7 +50,9 @@
 #define SLIDINGWINDOW_H
  
 #include <algorithm>
+#include <type_traits>
 #include "utils.hpp"
+#include "costmodel.hpp"
 
 /**
  * \brief     Memory resource pragma instantiation for the sliding window generator, default resource
@@ -181,6 +183,10 @@ void ConvolutionInputGenerator(
   const unsigned int max_cycles = std::max(cycles_write_block,cycles_read_block);
   const unsigned int baseIter = IFMDim * ConvKernelDim * multiplying_factor// Initial buffer
 			                  + OFMDim * std::max(cycles_write_block,cycles_read_block);
+  // the cost model accounts for the declared buffer and at least one cycle per input and output word
+  typedef cost::ConvolutionInputGenerator<ConvKernelDim, IFMChannels, Input_precision, IFMDim, OFMDim, SIMD, Stride>  KernelCost;
+  static_assert(KernelCost::buffer_bits == number_blocks * Stride * IFMDim * multiplying_factor * SIMD * Input_precision, "");
+  static_assert(KernelCost::cycles_per_image >= std::max(OFMDim * OFMDim * ConvKernelDim * ConvKernelDim * multiplying_factor, IFMDim * IFMDim * multiplying_factor), "");
   unsigned int counter_internal_block = 0;
   unsigned int current_block_write = 0;
   unsigned int current_line = 0;
@@ -188,8 +194,10 @@ void ConvolutionInputGenerator(
   unsigned int inp = 0, ofm_y = 0, ofm_x = 0, k_y = 0, k_x = 0, count_simd =0;
 
   for (unsigned int count_image = 0; count_image < numReps; count_image++) {
+    FINN_HLSLIB_COUNT_IMAGE();
     for (unsigned int i = 0; i < baseIter; i++) {
 #pragma HLS pipeline style=flp II=1
+      FINN_HLSLIB_COUNT_ITERATION();
       if (inp < IFMDim * ConvKernelDim*multiplying_factor) {// Initial buffer of ConvKernelDim lines	
         ap_uint<SIMD*Input_precision> inElem;
         inElem = in.read();
@@ -264,6 +272,537 @@ void ConvolutionInputGenerator(
   } // End count_image
 } // End generator
 
+/**
+ * \brief Sliding Window unit that produces output vectors for feeding
+ * a Matrix_Vector_Activate_Batch, implementing the im2col algorithm with a reduced line buffer.
+ * Drop-in replacement of ConvolutionInputGenerator, with the same output order, for any ConvKernelDim and Stride.
+ *
+ * The buffer is a single circular memory instead of ConvKernelDim/Stride+1 partitioned blocks of Stride lines.
+ * It spans the ConvKernelDim-1 lines plus ConvKernelDim pixels of a window and, for Stride > 1, the part of the
+ * next Stride-1 lines that the write side must have received by the end of an output row so that the next row
+ * does not wait for its last line (see cost::lowmem_buffer_words). This keeps the cycles at or below the ones of
+ * ConvolutionInputGenerator. The buffer is smaller than its line buffer except for large kernels with
+ * Stride close to half the kernel (e.g. 7x7 with stride 4) and images of a few windows, where
+ * ConvolutionInputGenerator is the better choice.
+ *
+ * Input pixels and output words are scheduled independently: an output word is produced two cycles after its
+ * input pixel has been written, and an input pixel is written once the one it overwrites is older than the first
+ * pixel of the current window. With PackedGroups > 1, the buffer words hold PackedGroups consecutive SIMD groups
+ * (e.g. 72-bit words for the URAM), which the write side assembles before writing a whole buffer word.
+ *
+ * \tparam ConvKernelDim    Dimension of the convolutional kernel (assumed square)
+ * \tparam IFMChannels      Number of Input Feature Maps
+ * \tparam Input_precision  Number bits per pixel
+ * \tparam IFMDim           Width and Heigth of the Input Feature Map (assumed square)
+ * \tparam OFMDim           Width and Heigth of the Output Feature Map (assumed square)
+ * \tparam SIMD             Number of input columns computed in parallel
+ * \tparam Stride           Stride of the convolutional kernel
+ * \tparam PackedGroups     Number of SIMD groups per buffer word, a power of two
+ * \tparam R          	  Datatype for the resource used for FPGA implementation of the SWG  - safely deducible from the paramaters
+ *
+ * \param in                Input stream
+ * \param out               Output stream
+ * \param numReps           Number of time the function has to be repeatedly executed (e.g. number of images)
+ * \param r			  Resource type for the hardware implementation of the memory block
+ */
+template<unsigned int ConvKernelDim,
+		 unsigned int IFMChannels,
+		 unsigned int Input_precision,
+		 unsigned int IFMDim,
+		 unsigned int OFMDim,
+		 unsigned int SIMD,
+		 unsigned int Stride,
+		 unsigned int PackedGroups = 1,
+		 typename R>
+void ConvolutionInputGenerator_lowmem(
+		hls::stream<ap_uint<SIMD*Input_precision> > & in,
+		hls::stream<ap_uint<SIMD*Input_precision> > & out,
+		const unsigned int numReps,
+		R const &r) {
+  static_assert(IFMChannels % SIMD == 0, "");
+  static_assert(IFMDim >= ConvKernelDim, "");
+  static_assert(OFMDim == (IFMDim - ConvKernelDim)/Stride + 1, "");
+  static_assert((PackedGroups > 0) && ((PackedGroups & (PackedGroups - 1)) == 0), "PackedGroups must be a power of two");
+  constexpr unsigned  multiplying_factor = IFMChannels/SIMD;
+  constexpr unsigned  line_length = IFMDim * multiplying_factor;
+  constexpr unsigned  total_words = IFMDim * line_length;
+  // the write side runs ahead by the lines of the next output row, less what it catches up with
+  constexpr unsigned  row_reads = OFMDim * ConvKernelDim * ConvKernelDim * multiplying_factor;
+  constexpr unsigned  row_writes = Stride * line_length;
+  constexpr unsigned  window_words = (ConvKernelDim - 1) * line_length + ConvKernelDim * multiplying_factor;
+  constexpr unsigned  row_lead = (Stride + ConvKernelDim - 1) * line_length + ConvKernelDim * multiplying_factor;
+  constexpr unsigned  row_credit = (OFMDim - 1) * Stride * multiplying_factor
+                                   + (ConvKernelDim - 1) * ConvKernelDim * multiplying_factor
+                                   + (row_writes > row_reads? row_writes - row_reads : 0);
+  constexpr unsigned  lead_words = row_lead > row_credit? row_lead - row_credit : 0;
+  // plus the words in flight, in whole packed buffer words
+  constexpr unsigned  buffer_size = ((window_words > lead_words? window_words : lead_words) + 3 * PackedGroups - 1) / PackedGroups;
+  constexpr unsigned  buffer_words = buffer_size * PackedGroups;
+  typedef cost::ConvolutionInputGenerator_lowmem<ConvKernelDim, IFMChannels, Input_precision, IFMDim, OFMDim, SIMD, Stride, PackedGroups>  KernelCost;
+  static_assert(KernelCost::buffer_bits == buffer_words * SIMD * Input_precision, "");
+  // window moves in the buffer, at most one wrap-around per move
+  constexpr unsigned  column_step = (Stride * multiplying_factor) % buffer_words;
+  constexpr unsigned  row_step = (Stride * line_length) % buffer_words;
+
+  ap_uint<PackedGroups*SIMD*Input_precision> inputBuf[buffer_size];
+  memory_resource(inputBuf, r);
+
+  for (unsigned int count_image = 0; count_image < numReps; count_image++) {
+    FINN_HLSLIB_COUNT_IMAGE();
+    // write side: input words received and their buffer address, words written to the buffer in the last two
+    // iterations and the buffer word being assembled
+    unsigned int wr_word = 0, wr_addr = 0, wr_done = 0, wr_done_d = 0;
+    ap_uint<PackedGroups*SIMD*Input_precision> wr_pack = 0;
+    // read side: first word of the current window (position in the image and buffer address)
+    // and offset of the next output word from it
+    unsigned int base_word = 0, base_addr = 0, row_word = 0, row_addr = 0, rd_offset = 0;
+    unsigned int ofm_y = 0, ofm_x = 0, k_y = 0, k_x = 0, count_simd = 0;
+    bool done = false;
+    while (!done || (wr_word < total_words)) {
+#pragma HLS pipeline style=flp II=1
+      FINN_HLSLIB_COUNT_ITERATION();
+      // a word is read at the earliest two iterations after it has been written
+      unsigned int const  rd_avail = wr_done_d;
+      wr_done_d = wr_done;
+      // the buffer word is free once all the words it held are older than the first word of the window at the
+      // start of the iteration, so that it is never the one read in the same iteration
+      bool const  in_free = (wr_word < total_words) && (done || ((wr_word | (PackedGroups - 1)) < base_word + buffer_words));
+      if (!done && (base_word + rd_offset < rd_avail)) {
+        unsigned int rd_addr = base_addr + rd_offset;
+        if (rd_addr >= buffer_words) {
+          rd_addr -= buffer_words;
+        }
+        ap_uint<PackedGroups*SIMD*Input_precision> const  packed = inputBuf[rd_addr / PackedGroups];
+        unsigned int const  lane = rd_addr % PackedGroups;
+        out.write(packed((lane + 1) * SIMD * Input_precision - 1, lane * SIMD * Input_precision));
+
+        // next output word, channels innermost
+        count_simd++;
+        rd_offset++;
+        if (count_simd == multiplying_factor) {
+          count_simd = 0;
+          k_x++;
+          if (k_x == ConvKernelDim) {
+            k_x = 0;
+            k_y++;
+            rd_offset += line_length - ConvKernelDim * multiplying_factor;
+            if (k_y == ConvKernelDim) {
+              k_y = 0;
+              rd_offset = 0;
+              ofm_x++;
+              base_word += Stride * multiplying_factor;
+              base_addr += column_step;
+              if (ofm_x == OFMDim) {
+                ofm_x = 0;
+                ofm_y++;
+                row_word += Stride * line_length;
+                row_addr += row_step;
+                if (row_addr >= buffer_words) {
+                  row_addr -= buffer_words;
+                }
+                base_word = row_word;
+                base_addr = row_addr;
+                if (ofm_y == OFMDim) {
+                  done = true;
+                }
+              }
+              if (base_addr >= buffer_words) {
+                base_addr -= buffer_words;
+              }
+            }
+          }
+        }
+      }
+
+      if (in_free) {
+        ap_uint<SIMD*Input_precision> inElem;
+        inElem = in.read();
+        unsigned int const  lane = wr_addr % PackedGroups;
+        wr_pack((lane + 1) * SIMD * Input_precision - 1, lane * SIMD * Input_precision) = inElem;
+        wr_word++;
+        // a buffer word is written once assembled, or with the last word of the image
+        if ((lane == PackedGroups - 1) || (wr_word == total_words)) {
+          inputBuf[wr_addr / PackedGroups] = wr_pack;
+#pragma HLS DEPENDENCE variable=inputBuf inter RAW distance=2 true
+#pragma HLS DEPENDENCE variable=inputBuf intra false
+          wr_done = wr_word;
+        }
+        wr_addr++;
+        if (wr_addr == buffer_words) {
+          wr_addr = 0;
+        }
+      }
+    } // End base_iter
+  } // End count_image
+} // End generator
+
+/**
+ * \brief Sliding Window unit that produces output vectors for feeding
+ * a Matrix_Vector_Activate_Batch, implementing the im2col algorithm with the feature map dimensions,
+ * the channels, the kernel and the stride set at runtime
+ *
+ * The line buffer is sized by the compile-time maxima. The runtime configuration must satisfy
+ * ConvKernelDim <= MaxConvKernelDim, Stride <= MaxStride, IFMDim <= MaxIFMDim,
+ * IFMChannels <= MaxIFMChannels, IFMChannels % SIMD == 0 and OFMDim = (IFMDim - ConvKernelDim)/Stride + 1.
+ * Input rows beyond the last window are consumed and discarded. The output order is the one of
+ * ConvolutionInputGenerator.
+ *
+ * \tparam MaxConvKernelDim    Maximum dimension of the convolutional kernel (assumed square)
+ * \tparam MaxIFMChannels      Maximum number of Input Feature Maps
+ * \tparam Input_precision     Number bits per pixel
+ * \tparam MaxIFMDim           Maximum width and heigth of the Input Feature Map (assumed square)
+ * \tparam SIMD                Number of input columns computed in parallel
+ * \tparam MaxStride           Maximum stride of the convolutional kernel
+ * \tparam R          	     Datatype for the resource used for FPGA implementation of the SWG  - safely deducible from the paramaters
+ *
+ * \param in                   Input stream
+ * \param out                  Output stream
+ * \param ConvKernelDim        Dimension of the convolutional kernel (assumed square)
+ * \param IFMChannels          Number of Input Feature Maps
+ * \param IFMDim               Width and Heigth of the Input Feature Map (assumed square)
+ * \param OFMDim               Width and Heigth of the Output Feature Map (assumed square)
+ * \param Stride               Stride of the convolutional kernel
+ * \param numReps              Number of time the function has to be repeatedly executed (e.g. number of images)
+ * \param r			     Resource type for the hardware implementation of the memory block
+ */
+template<unsigned int MaxConvKernelDim, 
+		 unsigned int MaxIFMChannels,
+		 unsigned int Input_precision,		
+		 unsigned int MaxIFMDim, 
+		 unsigned int SIMD,
+		 unsigned int MaxStride, 
+		 typename R>  
+void ConvolutionInputGenerator_dynamic(
+		hls::stream<ap_uint<SIMD*Input_precision> > & in,
+		hls::stream<ap_uint<SIMD*Input_precision> > & out,
+		const unsigned int ConvKernelDim,
+		const unsigned int IFMChannels,
+		const unsigned int IFMDim,
+		const unsigned int OFMDim,
+		const unsigned int Stride,
+		const unsigned int numReps,
+		R const &r) {
+  static_assert(MaxIFMChannels % SIMD == 0, "");
+  constexpr unsigned int max_multiplying_factor = MaxIFMChannels/SIMD;
+  constexpr unsigned int max_number_lines = MaxConvKernelDim + MaxStride;
+  // the cost model accounts for the declared buffer, its cycles are computed from the runtime configuration
+  typedef cost::ConvolutionInputGenerator_dynamic<MaxConvKernelDim, MaxIFMChannels, Input_precision, MaxIFMDim, SIMD, MaxStride>  KernelCost;
+  static_assert(KernelCost::buffer_bits == max_number_lines * MaxIFMDim * max_multiplying_factor * SIMD * Input_precision, "");
+  ap_uint<SIMD*Input_precision> inputBuf[max_number_lines][MaxIFMDim * max_multiplying_factor];
+#pragma HLS DEPENDENCE variable=inputBuf inter false
+#pragma HLS DEPENDENCE variable=inputBuf intra false
+  memory_resource(inputBuf, r);
+  const unsigned int multiplying_factor = IFMChannels/SIMD;
+  const unsigned int line_length = IFMDim * multiplying_factor;
+  // the current window occupies ConvKernelDim lines, the next Stride lines are filled meanwhile
+  const unsigned int number_lines = ConvKernelDim + Stride;
+  const unsigned int cycles_write_block = OFMDim * ConvKernelDim * ConvKernelDim * multiplying_factor;
+  const unsigned int cycles_read_block = Stride * line_length;
+  const unsigned int max_cycles = std::max(cycles_write_block,cycles_read_block);
+  const unsigned int initial_reads = ConvKernelDim * line_length;
+  const unsigned int total_reads = IFMDim * line_length;
+  const unsigned int baseIter = initial_reads // Initial buffer
+			                  + OFMDim * max_cycles;
+
+  for (unsigned int count_image = 0; count_image < numReps; count_image++) {
+    unsigned int inp = 0, counter_internal_block = 0;
+    unsigned int write_line = 0, write_col = 0;
+    unsigned int top_line = 0, read_line = 0, read_base = 0, read_col = 0;
+    unsigned int ofm_x = 0, k_y = 0, k_x = 0, count_simd = 0;
+    FINN_HLSLIB_COUNT_IMAGE();
+    for (unsigned int i = 0; i < baseIter; i++) {
+#pragma HLS pipeline style=flp II=1
+      FINN_HLSLIB_COUNT_ITERATION();
+      bool read_input;
+      if (inp < initial_reads) {// Initial buffer of ConvKernelDim lines
+        read_input = true;
+      } else {
+        if (counter_internal_block < cycles_write_block) { // We are writing output, SIMD IFMChan per cycle
+          ap_uint<SIMD*Input_precision> outElem = inputBuf[read_line][read_col];
+          out.write(outElem);
+          read_col++;
+          count_simd++;
+          if (count_simd == multiplying_factor) {
+            count_simd = 0;
+            k_x++;
+            if (k_x == ConvKernelDim) {
+              k_x = 0;
+              read_col = read_base;
+              read_line++;
+              if (read_line == number_lines) {
+                read_line = 0;
+              }
+              k_y++;
+              if (k_y == ConvKernelDim) {
+                k_y = 0;
+                read_base += Stride * multiplying_factor;
+                ofm_x++;
+                if (ofm_x == OFMDim) {
+                  // next output row, its window starts Stride lines below
+                  ofm_x = 0;
+                  read_base = 0;
+                  top_line += Stride;
+                  if (top_line >= number_lines) {
+                    top_line -= number_lines;
+                  }
+                }
+                read_col = read_base;
+                read_line = top_line;
+              }
+            }
+          }
+        }
+        // In parallel we fill the next Stride lines, if any input is left
+        read_input = (counter_internal_block < cycles_read_block) && (inp < total_reads);
+        counter_internal_block++;
+        if (counter_internal_block == max_cycles) {
+          counter_internal_block = 0;
+        }
+      }
+      if (read_input) {
+        ap_uint<SIMD*Input_precision> inElem;
+        inElem = in.read();
+        inputBuf[write_line][write_col] = inElem;
+        inp++;
+        write_col++;
+        if (write_col == line_length) {
+          write_col = 0;
+          write_line++;
+          if (write_line == number_lines) {
+            write_line = 0;
+          }
+        }
+      }
+    } // End base_iter
+  } // End count_image
+} // End generator
+
+/**
+ * \brief Padding value of the sliding window generators with fused padding, one element of SIMD channels
+ *
+ * ap_padding_zero yields zeros and ap_padding_const<V> yields V in every channel. ap_padding_replicate
+ * does not use a value, the nearest border pixel is produced instead.
+ */
+template<unsigned int SIMD, unsigned int Input_precision>
+ap_uint<SIMD*Input_precision> padding_value(ap_padding_zero const&) {
+#pragma HLS inline
+  return  0;
+}
+template<unsigned int SIMD, unsigned int Input_precision, int V>
+ap_uint<SIMD*Input_precision> padding_value(ap_padding_const<V> const&) {
+#pragma HLS inline
+  ap_uint<SIMD*Input_precision>  val;
+  for(unsigned int s = 0; s < SIMD; s++) {
+#pragma HLS UNROLL
+    val((s+1)*Input_precision-1, s*Input_precision) = ap_uint<Input_precision>(V);
+  }
+  return  val;
+}
+template<unsigned int SIMD, unsigned int Input_precision>
+ap_uint<SIMD*Input_precision> padding_value(ap_padding_replicate const&) {
+#pragma HLS inline
+  return  0;
+}
+
+/**
+ * \brief Sliding Window unit that produces output vectors for feeding
+ * a Matrix_Vector_Activate_Batch, implementing the im2col algorithm on an implicitly padded input
+ *
+ * Replaces a FMPadding followed by a ConvolutionInputGenerator. Only the IFMDim x IFMDim input pixels
+ * are streamed in and stored, the padding pixels are produced while reading the line buffer. The
+ * output order is the one of ConvolutionInputGenerator on the padded feature map, with
+ * OFMDim = (PaddingBefore + IFMDim + PaddingBehind - ConvKernelDim)/Stride + 1.
+ *
+ * \tparam ConvKernelDim    Dimension of the convolutional kernel (assumed square)
+ * \tparam IFMChannels      Number of Input Feature Maps
+ * \tparam Input_precision  Number bits per pixel
+ * \tparam IFMDim           Width and Heigth of the unpadded Input Feature Map (assumed square)
+ * \tparam OFMDim           Width and Heigth of the Output Feature Map (assumed square)
+ * \tparam SIMD             Number of input columns computed in parallel
+ * \tparam Stride           Stride of the convolutional kernel
+ * \tparam PaddingBefore    Top / left padding
+ * \tparam PaddingBehind    Bottom / right padding
+ * \tparam P                Padding mode: ap_padding_zero, ap_padding_const<V> or ap_padding_replicate  - safely deducible from the paramaters
+ * \tparam R          	  Datatype for the resource used for FPGA implementation of the SWG  - safely deducible from the paramaters
+ *
+ * \param in                Input stream
+ * \param out               Output stream
+ * \param numReps           Number of time the function has to be repeatedly executed (e.g. number of images)
+ * \param p                 Padding mode
+ * \param r			  Resource type for the hardware implementation of the memory block
+ */
+template<unsigned int ConvKernelDim, 
+		 unsigned int IFMChannels,
+		 unsigned int Input_precision,		
+		 unsigned int IFMDim, 
+		 unsigned int OFMDim,
+		 unsigned int SIMD,
+		 unsigned int Stride, 
+		 unsigned int PaddingBefore,
+		 unsigned int PaddingBehind,
+		 typename P,
+		 typename R>  
+void ConvolutionInputGenerator_padded(
+		hls::stream<ap_uint<SIMD*Input_precision> > & in,
+		hls::stream<ap_uint<SIMD*Input_precision> > & out,
+		const unsigned int numReps,
+		P const &p,
+		R const &r) {
+  static_assert(IFMChannels % SIMD == 0, "");
+  static_assert(PaddingBefore < ConvKernelDim, "");
+  static_assert(ConvKernelDim - PaddingBefore <= IFMDim, "");
+  static_assert(OFMDim == (PaddingBefore + IFMDim + PaddingBehind - ConvKernelDim)/Stride + 1, "");
+  constexpr bool replicate = std::is_same<P, ap_padding_replicate>::value;
+  constexpr unsigned int multiplying_factor = IFMChannels/SIMD;
+  // the current window occupies ConvKernelDim lines, the next Stride lines are filled meanwhile;
+  // padded row y is kept in line y % number_lines
+  constexpr unsigned int number_lines = ConvKernelDim + Stride;
+  constexpr unsigned int line_length = IFMDim * multiplying_factor;
+  ap_uint<SIMD*Input_precision> inputBuf[number_lines][line_length];
+#pragma HLS DEPENDENCE variable=inputBuf inter false
+#pragma HLS DEPENDENCE variable=inputBuf intra false
+  memory_resource(inputBuf, r);
+  constexpr unsigned int first_line = PaddingBefore % number_lines;
+  constexpr unsigned int last_line = (PaddingBefore + IFMDim - 1) % number_lines;
+  constexpr unsigned int cycles_write_block = OFMDim * ConvKernelDim * ConvKernelDim * multiplying_factor;
+  constexpr unsigned int cycles_read_block = Stride * line_length;
+  constexpr unsigned int max_cycles = std::max(cycles_write_block,cycles_read_block);
+  constexpr unsigned int initial_reads = (ConvKernelDim - PaddingBefore) * line_length;
+  constexpr unsigned int total_reads = IFMDim * line_length;
+  constexpr unsigned int baseIter = initial_reads // Initial buffer
+			                      + OFMDim * max_cycles;
+  // the cost model accounts for the declared buffer and at least one cycle per input and output word
+  typedef cost::ConvolutionInputGenerator_padded<ConvKernelDim, IFMChannels, Input_precision, IFMDim, OFMDim, SIMD, Stride, PaddingBefore, PaddingBehind>  KernelCost;
+  static_assert(KernelCost::buffer_bits == number_lines * line_length * SIMD * Input_precision, "");
+  static_assert(KernelCost::cycles_per_image >= std::max(OFMDim * OFMDim * ConvKernelDim * ConvKernelDim * multiplying_factor, IFMDim * IFMDim * multiplying_factor), "");
+  ap_uint<SIMD*Input_precision> const  pad = padding_value<SIMD, Input_precision>(p);
+
+  for (unsigned int count_image = 0; count_image < numReps; count_image++) {
+    unsigned int inp = 0, counter_internal_block = 0;
+    unsigned int write_line = first_line, write_col = 0;
+    unsigned int top_line = 0, read_line = 0;
+    // padded coordinates of the current kernel pixel
+    unsigned int ofm_y = 0, ofm_x = 0, k_y = 0, k_x = 0, count_simd = 0;
+    for (unsigned int i = 0; i < baseIter; i++) {
+#pragma HLS pipeline style=flp II=1
+      bool read_input;
+      if (inp < initial_reads) {// Initial buffer of the unpadded lines of the first window
+        read_input = true;
+      } else {
+        if (counter_internal_block < cycles_write_block) { // We are writing output, SIMD IFMChan per cycle
+          unsigned int const y = ofm_y*Stride + k_y;
+          unsigned int const x = ofm_x*Stride + k_x;
+          bool const pad_y = (y < PaddingBefore) || (y >= PaddingBefore + IFMDim);
+          bool const pad_x = (x < PaddingBefore) || (x >= PaddingBefore + IFMDim);
+          unsigned int const line = !pad_y? read_line : (y < PaddingBefore)? first_line : last_line;
+          unsigned int const col = !pad_x? x - PaddingBefore : (x < PaddingBefore)? 0 : IFMDim-1;
+          ap_uint<SIMD*Input_precision> outElem = inputBuf[line][col*multiplying_factor + count_simd];
+          if (!replicate && (pad_y || pad_x)) {
+            outElem = pad;
+          }
+          out.write(outElem);
+          count_simd++;
+          if (count_simd == multiplying_factor) {
+            count_simd = 0;
+            k_x++;
+            if (k_x == ConvKernelDim) {
+              k_x = 0;
+              read_line++;
+              if (read_line == number_lines) {
+                read_line = 0;
+              }
+              k_y++;
+              if (k_y == ConvKernelDim) {
+                k_y = 0;
+                ofm_x++;
+                if (ofm_x == OFMDim) {
+                  // next output row, its window starts Stride lines below
+                  ofm_x = 0;
+                  ofm_y++;
+                  top_line += Stride;
+                  if (top_line >= number_lines) {
+                    top_line -= number_lines;
+                  }
+                }
+                read_line = top_line;
+              }
+            }
+          }
+        }
+        // In parallel we fill the next Stride lines, if any input is left
+        read_input = (counter_internal_block < cycles_read_block) && (inp < total_reads);
+        counter_internal_block++;
+        if (counter_internal_block == max_cycles) {
+          counter_internal_block = 0;
+        }
+      }
+      if (read_input) {
+        ap_uint<SIMD*Input_precision> inElem;
+        inElem = in.read();
+        inputBuf[write_line][write_col] = inElem;
+        inp++;
+        write_col++;
+        if (write_col == line_length) {
+          write_col = 0;
+          write_line++;
+          if (write_line == number_lines) {
+            write_line = 0;
+          }
+        }
+      }
+    } // End base_iter
+  } // End count_image
+} // End generator
+
+/**
+ * \brief Sliding Window unit that produces output vectors for feeding
+ * a Matrix_Vector_Activate_Batch, implementing a transposed convolution (deconvolution) by sub-pixel decomposition
+ *
+ * Instead of inserting Stride-1 zeros between the input pixels, the transposed convolution with kernel
+ * ConvKernelDim and stride Stride is split into Stride x Stride phases, each one being a convolution with
+ * Taps = ceil(ConvKernelDim/Stride) taps per dimension over the input zero padded by Taps-1 pixels on each side.
+ * When ConvKernelDim is not a multiple of Stride, the kernel is zero padded at its end to Taps*Stride.
+ * All the phases share the same window, so that the generator produces (IFMDim + Taps - 1)^2 windows of
+ * Taps x Taps pixels, each one in the order of ConvolutionInputGenerator. The following Matrix_Vector_Activate_Batch
+ * computes all phases at once with the phase-decomposed weight matrix:
+ *  - row (p_y*Stride + p_x)*OFMChannels + o, for output phase (p_y, p_x) and output channel o
+ *  - column (t_y*Taps + t_x)*IFMChannels + i, for window tap (t_y, t_x) and input channel i
+ *  - holding kernel element [o][i][(Taps-1-t_y)*Stride + p_y][(Taps-1-t_x)*Stride + p_x], or zero if either
+ *    index is ConvKernelDim or above
+ * and a DepthToSpace rearranges the phases of every window into Stride x Stride output pixels. The output then
+ * spans (IFMDim + Taps - 1)*Stride pixels, of which the last Taps*Stride - ConvKernelDim are always zero.
+ *
+ * \tparam ConvKernelDim    Dimension of the convolutional kernel (assumed square)
+ * \tparam IFMChannels      Number of Input Feature Maps
+ * \tparam Input_precision  Number bits per pixel
+ * \tparam IFMDim           Width and Heigth of the Input Feature Map (assumed square)
+ * \tparam SIMD             Number of input columns computed in parallel
+ * \tparam Stride           Stride of the transposed convolution (upsampling factor)
+ * \tparam R          	  Datatype for the resource used for FPGA implementation of the SWG  - safely deducible from the paramaters
+ *
+ * \param in                Input stream
+ * \param out               Output stream
+ * \param numReps           Number of time the function has to be repeatedly executed (e.g. number of images)
+ * \param r			  Resource type for the hardware implementation of the memory block
+ */
+template<unsigned int ConvKernelDim,
+		 unsigned int IFMChannels,
+		 unsigned int Input_precision,
+		 unsigned int IFMDim,
+		 unsigned int SIMD,
+		 unsigned int Stride,
+		 typename R>
+void ConvolutionInputGenerator_Transposed(
+		hls::stream<ap_uint<SIMD*Input_precision> > & in,
+		hls::stream<ap_uint<SIMD*Input_precision> > & out,
+		const unsigned int numReps,
+		R const &r) {
+#pragma HLS inline
+  constexpr unsigned int Taps = (ConvKernelDim + Stride - 1) / Stride;
+  ConvolutionInputGenerator_padded<Taps, IFMChannels, Input_precision, IFMDim, IFMDim + Taps - 1,
+    SIMD, 1, Taps - 1, Taps - 1>(in, out, numReps, ap_padding_zero(), r);
+} // End generator
+
 /**
  * \brief Sliding Window unit that produces output vectors for feeding
  * a Matrix_Vector_Activate_Batch, implementing the im2col algorithm with support to multiple output pixels
@@ -315,6 +854,10 @@ void ConvolutionInputGenerator_MMV(
 	constexpr unsigned int max_cycles = std::max(cycles_write_block,cycles_read_block);
 	const unsigned int baseIter = IFMDim * ConvKernelDim * multiplying_factor// Initial buffer
 			+ OFMDim * std::max(cycles_write_block,cycles_read_block);
+	// the cost model accounts for the declared buffer and at least one cycle per input and output word
+	typedef cost::ConvolutionInputGenerator_MMV<ConvKernelDim, IFMChannels, Input_precision, IFMDim, OFMDim, SIMD, Stride, MMV>  KernelCost;
+	static_assert(KernelCost::buffer_bits == MMV * number_blocks * Stride * IFMDim * multiplying_factor * SIMD * Input_precision, "");
+	static_assert(KernelCost::cycles_per_image >= std::max(OFMDim * OFMDim * ConvKernelDim * ConvKernelDim * multiplying_factor / MMV, IFMDim * IFMDim * multiplying_factor), "");
 	unsigned int counter_internal_block = 0;
 	unsigned int current_block_write = 0;
 	unsigned int current_line = 0;
@@ -459,6 +1002,10 @@ void ConvolutionInputGenerator_kernel_stride(
 	constexpr unsigned  cycles_read_block = IFMDim * Stride * multiplying_factor;
 	constexpr unsigned  max_cycles = std::max(cycles_write_block, cycles_read_block);
 	constexpr unsigned  baseIter = (IFMDim * ConvKernelDim * multiplying_factor) + (OFMDim-1) * max_cycles+std::max(cycles_write_block,OFMDim);
+	// the cost model accounts for the declared buffer and at least one cycle per input and output word
+	typedef cost::ConvolutionInputGenerator_kernel_stride<ConvKernelDim, IFMChannels, Input_precision, IFMDim, OFMDim, SIMD, Stride>  KernelCost;
+	static_assert(KernelCost::buffer_bits == number_blocks * IFMDim * multiplying_factor * SIMD * Input_precision, "");
+	static_assert(KernelCost::cycles_per_image >= std::max(OFMDim * OFMDim * ConvKernelDim * ConvKernelDim * multiplying_factor, IFMDim * IFMDim * multiplying_factor), "");
 	constexpr unsigned  initial_buffer_cycles = (IFMDim * ConvKernelDim * multiplying_factor) ;
 
 	ap_uint<SIMD*Input_precision> inputBuf[number_blocks][IFMDim * multiplying_factor];
@@ -616,6 +1163,10 @@ void ConvolutionInputGenerator_kernel_stride_MMV(
 	const unsigned int cycles_read_block = IFMDim * Stride * multiplying_factor;
 	const unsigned int max_cycles = std::max(cycles_write_block, cycles_read_block);
 	const unsigned int baseIter = (IFMDim * ConvKernelDim * multiplying_factor) + (OFMDim-1) * max_cycles+std::max(cycles_write_block,OFMDim);
+	// the cost model accounts for the declared buffer and at least one cycle per input and output word
+	typedef cost::ConvolutionInputGenerator_kernel_stride_MMV<ConvKernelDim, IFMChannels, Input_precision, IFMDim, OFMDim, SIMD, Stride, MMV>  KernelCost;
+	static_assert(KernelCost::buffer_bits == MMV * number_blocks * IFMDim * multiplying_factor * SIMD * Input_precision, "");
+	static_assert(KernelCost::cycles_per_image >= std::max(OFMDim * OFMDim * ConvKernelDim * ConvKernelDim * multiplying_factor / MMV, IFMDim * IFMDim * multiplying_factor), "");
 	const unsigned int initial_buffer_cycles = (IFMDim * ConvKernelDim * multiplying_factor) ;
 	unsigned int counter_internal_block = 0;
 	unsigned int current_line = 0;
@@ -732,12 +1283,17 @@ for (unsigned int count_image = 0; count_image < numReps; count_image++) {
  * a Vector_Vector_Activate_Batch, implementing the im2col algorithm for depthwise separable convolutions. To be used only if 
  * ConvKernelDim%Stride = 0 and square kernel
  *
+ * Every output word carries TapSIMD consecutive kernel taps (row-major within the kernel) of SIMD
+ * channels each, tap-major, as consumed by a Vector_Vector_Activate_Batch with SIMD = TapSIMD and
+ * PE = SIMD. The line buffer is replicated TapSIMD times to read all taps of a word in one cycle.
+ *
  * \tparam ConvKernelDim    Dimension of the convolutional kernel (assumed square)
  * \tparam IFMChannels      Number of Input Feature Maps
  * \tparam Input_precision  Number bits per pixel
  * \tparam IFMDim           Width and Heigth of the Input Feature Map (assumed square)
  * \tparam OFMDim           Width and Heigth of the Output Feature Map (assumed square)
  * \tparam SIMD             Number of input columns computed in parallel
+ * \tparam TapSIMD          Number of kernel taps produced in parallel, must divide ConvKernelDim^2
  * \tparam Stride           Stride of the convolutional kernel
  * \tparam R          	  Datatype for the resource used for FPGA implementation of the SWG  - safely deducible from the paramaters
  *
@@ -752,30 +1308,37 @@ template<unsigned int ConvKernelDim,
 		 unsigned int IFMDim, 
 		 unsigned int OFMDim,
 		 unsigned int SIMD,
+		 unsigned int TapSIMD,
 		 unsigned int Stride, 
 		 typename R>  
 void ConvolutionInputGenerator_dws(
 		hls::stream<ap_uint<SIMD*Input_precision> > & in,
-		hls::stream<ap_uint<SIMD*Input_precision> > & out,
+		hls::stream<ap_uint<TapSIMD*SIMD*Input_precision> > & out,
 		const unsigned int numReps,
 		R const &r) {
   static_assert(IFMChannels % SIMD == 0, "");
   static_assert(ConvKernelDim % Stride == 0, "");
+  static_assert((ConvKernelDim * ConvKernelDim) % TapSIMD == 0, "");
   const unsigned int multiplying_factor = IFMChannels/SIMD;
   const unsigned int number_blocks = ConvKernelDim/Stride + 1 ;
-  ap_uint<SIMD*Input_precision> inputBuf[number_blocks][Stride * IFMDim * multiplying_factor];
+  ap_uint<SIMD*Input_precision> inputBuf[TapSIMD][number_blocks][Stride * IFMDim * multiplying_factor];
 #pragma HLS ARRAY_PARTITION variable=inputBuf complete dim=1
+#pragma HLS ARRAY_PARTITION variable=inputBuf complete dim=2
   memory_resource(inputBuf, r);
-  const unsigned int cycles_write_block = (OFMDim * ConvKernelDim * ConvKernelDim * multiplying_factor);
+  const unsigned int cycles_write_block = (OFMDim * ConvKernelDim * ConvKernelDim * multiplying_factor) / TapSIMD;
   const unsigned int cycles_read_block = Stride * IFMDim * multiplying_factor;
   const unsigned int max_cycles = std::max(cycles_write_block,cycles_read_block);
   const unsigned int baseIter = IFMDim * ConvKernelDim * multiplying_factor// Initial buffer
 			                  + OFMDim * std::max(cycles_write_block,cycles_read_block);
+  // the cost model accounts for the declared buffer and at least one cycle per input and output word
+  typedef cost::ConvolutionInputGenerator_dws<ConvKernelDim, IFMChannels, Input_precision, IFMDim, OFMDim, SIMD, TapSIMD, Stride>  KernelCost;
+  static_assert(KernelCost::buffer_bits == TapSIMD * number_blocks * Stride * IFMDim * multiplying_factor * SIMD * Input_precision, "");
+  static_assert(KernelCost::cycles_per_image >= std::max(OFMDim * OFMDim * ConvKernelDim * ConvKernelDim * multiplying_factor / TapSIMD, IFMDim * IFMDim * multiplying_factor), "");
   unsigned int counter_internal_block = 0;
   unsigned int current_block_write = 0;
   unsigned int current_line = 0;
   unsigned int read_block = 0; 
-  unsigned int inp = 0, ofm_y = 0, ofm_x = 0, k_y = 0, k_x = 0, count_simd =0;
+  unsigned int inp = 0, ofm_y = 0, ofm_x = 0, k = 0, count_simd =0;
 
   for (unsigned int count_image = 0; count_image < numReps; count_image++) {
     for (unsigned int i = 0; i < baseIter; i++) {
@@ -783,7 +1346,10 @@ void ConvolutionInputGenerator_dws(
       if (inp < IFMDim * ConvKernelDim*multiplying_factor) {// Initial buffer of ConvKernelDim lines	
         ap_uint<SIMD*Input_precision> inElem;
         inElem = in.read();
-        inputBuf[current_block_write][current_line] = inElem;
+        for (unsigned int t = 0; t < TapSIMD; t++) {
+#pragma HLS UNROLL
+          inputBuf[t][current_block_write][current_line] = inElem;
+        }
         current_line++;
         inp++;
         if (current_line == Stride * IFMDim * multiplying_factor ) {
@@ -796,31 +1362,33 @@ void ConvolutionInputGenerator_dws(
           counter_internal_block = 0;
         }
       } else {
-        if (counter_internal_block < cycles_write_block-1) { // We are writing output, MMV IFMChan per cycle
-          unsigned int current_block_read = (current_block_write + 1 + k_y / Stride);
-          if (current_block_read >= number_blocks) {
-            current_block_read-= number_blocks;
-		  }
-          unsigned int current_line_in_block = ((k_y%Stride) * IFMDim + ofm_x*Stride + k_x)*multiplying_factor + count_simd;
-          ap_uint<SIMD*Input_precision> outElem = inputBuf[current_block_read][(current_line_in_block)];
+        if (counter_internal_block < cycles_write_block-1) { // We are writing output, TapSIMD kernel taps per cycle
+          ap_uint<TapSIMD*SIMD*Input_precision> outElem;
+          for (unsigned int t = 0; t < TapSIMD; t++) {
+#pragma HLS UNROLL
+            unsigned int const k_y = (k + t) / ConvKernelDim;
+            unsigned int const k_x = (k + t) % ConvKernelDim;
+            unsigned int current_block_read = (current_block_write + 1 + k_y / Stride);
+            if (current_block_read >= number_blocks) {
+              current_block_read-= number_blocks;
+            }
+            unsigned int current_line_in_block = ((k_y%Stride) * IFMDim + ofm_x*Stride + k_x)*multiplying_factor + count_simd;
+            outElem((t+1)*SIMD*Input_precision-1, t*SIMD*Input_precision) = inputBuf[t][current_block_read][(current_line_in_block)];
+          }
           out.write(outElem);		
-		  k_x++;
-		  if (k_x == ConvKernelDim) {
-		    k_x = 0;
-		    k_y++;
-		    if (k_y == ConvKernelDim) {
-			  k_y = 0;
-			  count_simd++;
-			  if (count_simd == multiplying_factor) {
-			    count_simd=0;	
-                ofm_x ++;
-                if (ofm_x == OFMDim) {
-                  ofm_x = 0;
-                  ofm_y++;
-                  if (ofm_y == OFMDim) {
-                    ofm_y = 0;
-                    inp = 0;
-                  }
+		  k += TapSIMD;
+		  if (k == ConvKernelDim * ConvKernelDim) {
+			k = 0;
+			count_simd++;
+			if (count_simd == multiplying_factor) {
+			  count_simd=0;	
+              ofm_x ++;
+              if (ofm_x == OFMDim) {
+                ofm_x = 0;
+                ofm_y++;
+                if (ofm_y == OFMDim) {
+                  ofm_y = 0;
+                  inp = 0;
                 }
               }
             }
@@ -829,8 +1397,11 @@ void ConvolutionInputGenerator_dws(
         if ((counter_internal_block < cycles_read_block-1) && (read_block<IFMDim/Stride)) { // In parallel we write in the buffer, in the current block write if we still need to
           ap_uint<SIMD*Input_precision> inElem;
           inElem = in.read();
-          inputBuf[current_block_write][current_line] = inElem;
-#pragma AP dependence variable=inputBuf intra false
+          for (unsigned int t = 0; t < TapSIMD; t++) {
+#pragma HLS UNROLL
+            inputBuf[t][current_block_write][current_line] = inElem;
+          }
+#pragma AP dependence variable=inputBuf intra false
 #pragma AP dependence variable=inputBuf inter false
           current_line++;
           if (current_line == Stride * IFMDim * multiplying_factor) {// We read the whole block, we change the next block in which we want to we
@@ -854,6 +1425,42 @@ void ConvolutionInputGenerator_dws(
   } // End count_image
 } // End generator
 
+/**
+ * \brief Sliding Window unit that produces output vectors for feeding
+ * a Vector_Vector_Activate_Batch, implementing the im2col algorithm for depthwise separable convolutions. To be used only if 
+ * ConvKernelDim%Stride = 0 and square kernel. Produces a single kernel tap per output word.
+ *
+ * \tparam ConvKernelDim    Dimension of the convolutional kernel (assumed square)
+ * \tparam IFMChannels      Number of Input Feature Maps
+ * \tparam Input_precision  Number bits per pixel
+ * \tparam IFMDim           Width and Heigth of the Input Feature Map (assumed square)
+ * \tparam OFMDim           Width and Heigth of the Output Feature Map (assumed square)
+ * \tparam SIMD             Number of input columns computed in parallel
+ * \tparam Stride           Stride of the convolutional kernel
+ * \tparam R          	  Datatype for the resource used for FPGA implementation of the SWG  - safely deducible from the paramaters
+ *
+ * \param in                Input stream
+ * \param out               Output stream
+ * \param numReps           Number of time the function has to be repeatedly executed (e.g. number of images)
+ * \param r			  Resource type for the hardware implementation of the memory block
+ */
+template<unsigned int ConvKernelDim, 
+		 unsigned int IFMChannels,
+		 unsigned int Input_precision,		
+		 unsigned int IFMDim, 
+		 unsigned int OFMDim,
+		 unsigned int SIMD,
+		 unsigned int Stride, 
+		 typename R>  
+void ConvolutionInputGenerator_dws(
+		hls::stream<ap_uint<SIMD*Input_precision> > & in,
+		hls::stream<ap_uint<SIMD*Input_precision> > & out,
+		const unsigned int numReps,
+		R const &r) {
+#pragma HLS inline
+  ConvolutionInputGenerator_dws<ConvKernelDim, IFMChannels, Input_precision, IFMDim, OFMDim, SIMD, 1, Stride>(in, out, numReps, r);
+}
+
 
 /**
  * \brief Sliding Window unit that produces output vectors for feeding
@@ -896,6 +1503,10 @@ void ConvolutionInputGenerator_kernel_stride_dws(
     constexpr unsigned  cycles_read_block = IFMDim * Stride * multiplying_factor;
     constexpr unsigned  max_cycles = std::max(cycles_write_block, cycles_read_block);
     constexpr unsigned  baseIter = (IFMDim * ConvKernelDim * multiplying_factor) + (OFMDim-1) * max_cycles+std::max(cycles_write_block,OFMDim);
+    // the cost model accounts for the declared buffer and at least one cycle per input and output word
+    typedef cost::ConvolutionInputGenerator_kernel_stride_dws<ConvKernelDim, IFMChannels, Input_precision, IFMDim, OFMDim, SIMD, Stride>  KernelCost;
+    static_assert(KernelCost::buffer_bits == number_blocks * IFMDim * multiplying_factor * SIMD * Input_precision, "");
+    static_assert(KernelCost::cycles_per_image >= std::max(OFMDim * OFMDim * ConvKernelDim * ConvKernelDim * multiplying_factor, IFMDim * IFMDim * multiplying_factor), "");
     constexpr unsigned  initial_buffer_cycles = (IFMDim * ConvKernelDim * multiplying_factor) ;
 
     ap_uint<SIMD*Input_precision> inputBuf[number_blocks][IFMDim * multiplying_factor];
@@ -1055,6 +1666,10 @@ void ConvolutionInputGenerator_dws_MMV(
 	constexpr unsigned int max_cycles = std::max(cycles_write_block,cycles_read_block);
 	const unsigned int baseIter = IFMDim * ConvKernelDim * multiplying_factor// Initial buffer
 			+ OFMDim * std::max(cycles_write_block,cycles_read_block);
+	// the cost model accounts for the declared buffer and at least one cycle per input and output word
+	typedef cost::ConvolutionInputGenerator_dws_MMV<ConvKernelDim, IFMChannels, Input_precision, IFMDim, OFMDim, SIMD, Stride, MMV>  KernelCost;
+	static_assert(KernelCost::buffer_bits == MMV * number_blocks * Stride * IFMDim * multiplying_factor * SIMD * Input_precision, "");
+	static_assert(KernelCost::cycles_per_image >= std::max(OFMDim * OFMDim * ConvKernelDim * ConvKernelDim * multiplying_factor / MMV, IFMDim * IFMDim * multiplying_factor), "");
 	unsigned int counter_internal_block = 0;
 	unsigned int current_block_write = 0;
 	unsigned int current_line = 0;
@@ -1157,6 +1772,432 @@ void ConvolutionInputGenerator_dws_MMV(
 	} // End count_image
 } // End generator
 
+/**
+ * \brief Places one buffered element into the output word of ConvolutionInputGenerator_generic,
+ * a plain word for a single output pixel and one channel of a MultiChanData for MMV > 1
+ */
+template<int DataWidth>
+void swg_set_pixel(ap_uint<DataWidth> &outElem, unsigned int const, ap_uint<DataWidth> const &val) {
+#pragma HLS inline
+  outElem = val;
+}
+template<unsigned int NumChannels, unsigned int DataWidth, typename TI>
+void swg_set_pixel(MultiChanData<NumChannels, DataWidth> &outElem, unsigned int const  mmv, TI const &val) {
+#pragma HLS inline
+  outElem.data[mmv] = val;
+}
+
+/**
+ * \brief Sliding Window unit that produces output vectors for feeding
+ * a Matrix_Vector_Activate_Batch or a Vector_Vector_Activate_Batch, implementing the im2col algorithm
+ * for any combination of kernel size, stride and dilation, with optional support to multiple output pixels.
+ *
+ * The buffer holds only the (ConvKernelDim-1)*Dilation+1 input rows spanned by one window, independently
+ * of the stride. Input pixels and output words are scheduled independently: an output word is produced one
+ * cycle after its input pixel has been received, so that a buffer word is never read in the iteration right
+ * after the one writing it, and an input pixel overwrites the buffered one of the same column as soon as no
+ * pending window needs it anymore. Input rows not covered by any window are read and dropped.
+ *
+ * \tparam ConvKernelDim    Dimension of the convolutional kernel (assumed square)
+ * \tparam IFMChannels      Number of Input Feature Maps
+ * \tparam Input_precision  Number bits per pixel
+ * \tparam IFMDim           Width and Heigth of the Input Feature Map (assumed square)
+ * \tparam OFMDim           Width and Heigth of the Output Feature Map (assumed square)
+ * \tparam SIMD             Number of input columns computed in parallel
+ * \tparam Stride           Stride of the convolutional kernel
+ * \tparam Dilation         Dilation of the convolutional kernel
+ * \tparam MMV              Number of pixels that have to be produced in parallel
+ * \tparam DepthWise        Output order for Vector_Vector_Activate_Batch (channels outside of kernel pixels)
+ * \tparam TO               Datatype of the output stream, ap_uint<SIMD*Input_precision> for MMV = 1 or
+ *                          MultiChanData<MMV, SIMD*Input_precision> - safely deducible from the paramaters
+ * \tparam R          	  Datatype for the resource used for FPGA implementation of the SWG  - safely deducible from the paramaters
+ *
+ * \param in                Input stream
+ * \param out               Output stream
+ * \param numReps           Number of time the function has to be repeatedly executed (e.g. number of images)
+ * \param r			  Resource type for the hardware implementation of the memory block
+ */
+template<unsigned int ConvKernelDim,
+		 unsigned int IFMChannels,
+		 unsigned int Input_precision,
+		 unsigned int IFMDim,
+		 unsigned int OFMDim,
+		 unsigned int SIMD,
+		 unsigned int Stride,
+		 unsigned int Dilation,
+		 unsigned int MMV,
+		 bool DepthWise,
+		 typename TO,
+		 typename R>
+void ConvolutionInputGenerator_generic(
+		hls::stream<ap_uint<SIMD*Input_precision> > & in,
+		hls::stream<TO> & out,
+		const unsigned int numReps,
+		R const &r) {
+  static_assert(IFMChannels % SIMD == 0, "");
+  static_assert(OFMDim % MMV == 0, "");
+  constexpr unsigned  multiplying_factor = IFMChannels/SIMD;
+  // rows spanned by one (dilated) window
+  constexpr unsigned  number_lines = (ConvKernelDim - 1) * Dilation + 1;
+  static_assert(IFMDim >= number_lines, "");
+  static_assert(OFMDim == (IFMDim - number_lines)/Stride + 1, "");
+  constexpr unsigned  line_length = IFMDim * multiplying_factor;
+  constexpr unsigned  stride_lines = Stride % number_lines;
+  // the cost model accounts for the declared buffer and at least one cycle per input and output word
+  typedef cost::ConvolutionInputGenerator_generic<ConvKernelDim, IFMChannels, Input_precision, IFMDim, OFMDim, SIMD, Stride, Dilation, MMV>  KernelCost;
+  static_assert(KernelCost::buffer_bits == MMV * number_lines * line_length * SIMD * Input_precision, "");
+  static_assert(KernelCost::cycles_per_image >= std::max(OFMDim * OFMDim * ConvKernelDim * ConvKernelDim * multiplying_factor / MMV, IFMDim * line_length), "");
+
+  ap_uint<SIMD*Input_precision> inputBuf[MMV][number_lines][line_length];
+#pragma HLS ARRAY_PARTITION variable=inputBuf complete dim=1
+  memory_resource(inputBuf, r);
+
+  for (unsigned int count_image = 0; count_image < numReps; count_image++) {
+    // write side: position of the next input word, and the one at the start of the previous iteration
+    unsigned int wr_row = 0, wr_line = 0, wr_col = 0, wr_word = 0, wr_simd = 0, wr_row_d = 0, wr_word_d = 0;
+    // read side: window origin and position of the next output word
+    unsigned int row_base = 0, col_base = 0, top_line = 0, ofm_y = 0, ofm_x = 0;
+    unsigned int rd_row = 0, rd_col = 0, rd_line = 0, k_y = 0, k_x = 0, count_simd = 0;
+    bool done = false;
+    FINN_HLSLIB_COUNT_IMAGE();
+    while (!done || (wr_row < IFMDim)) {
+#pragma HLS pipeline style=flp II=1
+      FINN_HLSLIB_COUNT_ITERATION();
+      // a word is read at the earliest two iterations after it has been written
+      bool const  in_needed = !done && (rd_row >= wr_row_d) &&
+        ((rd_row > wr_row_d) || ((rd_col + (MMV - 1) * Stride) * multiplying_factor + count_simd >= wr_word_d));
+      wr_row_d = wr_row;
+      wr_word_d = wr_word;
+      // the buffered pixel is free once it is above the window or, for the last window row using it, left of it;
+      // evaluated with the window of the start of the iteration, it is never the one read in the same iteration
+      bool const  in_free = (wr_row < number_lines) || done || (wr_row - number_lines < row_base) ||
+        ((wr_row - number_lines < row_base + Stride) && (wr_col < col_base));
+      if (!done && !in_needed) {
+        TO outElem;
+        for (unsigned int v = 0; v < MMV; v++) {
+#pragma HLS UNROLL
+          swg_set_pixel(outElem, v, inputBuf[v][rd_line][(rd_col + v * Stride) * multiplying_factor + count_simd]);
+        }
+        out.write(outElem);
+
+        // next output word, kernel pixels innermost for depthwise, channels innermost otherwise
+        bool  pixel_done = false;
+        if (DepthWise) {
+          k_x++;
+          rd_col += Dilation;
+          if (k_x == ConvKernelDim) {
+            k_x = 0;
+            rd_col = col_base;
+            k_y++;
+            rd_row += Dilation;
+            rd_line += Dilation;
+            if (rd_line >= number_lines) {
+              rd_line -= number_lines;
+            }
+            if (k_y == ConvKernelDim) {
+              k_y = 0;
+              rd_row = row_base;
+              rd_line = top_line;
+              count_simd++;
+              if (count_simd == multiplying_factor) {
+                count_simd = 0;
+                pixel_done = true;
+              }
+            }
+          }
+        }
+        else {
+          count_simd++;
+          if (count_simd == multiplying_factor) {
+            count_simd = 0;
+            k_x++;
+            rd_col += Dilation;
+            if (k_x == ConvKernelDim) {
+              k_x = 0;
+              rd_col = col_base;
+              k_y++;
+              rd_row += Dilation;
+              rd_line += Dilation;
+              if (rd_line >= number_lines) {
+                rd_line -= number_lines;
+              }
+              if (k_y == ConvKernelDim) {
+                k_y = 0;
+                rd_row = row_base;
+                rd_line = top_line;
+                pixel_done = true;
+              }
+            }
+          }
+        }
+        if (pixel_done) {
+          ofm_x += MMV;
+          col_base += MMV * Stride;
+          if (ofm_x == OFMDim) {
+            ofm_x = 0;
+            col_base = 0;
+            ofm_y++;
+            row_base += Stride;
+            top_line += stride_lines;
+            if (top_line >= number_lines) {
+              top_line -= number_lines;
+            }
+            rd_row = row_base;
+            rd_line = top_line;
+            if (ofm_y == OFMDim) {
+              done = true;
+            }
+          }
+          rd_col = col_base;
+        }
+      }
+
+      if ((wr_row < IFMDim) && in_free) {
+        ap_uint<SIMD*Input_precision> inElem;
+        inElem = in.read();
+        for (unsigned int v = 0; v < MMV; v++) {
+#pragma HLS UNROLL
+          inputBuf[v][wr_line][wr_word] = inElem;
+        }
+#pragma HLS DEPENDENCE variable=inputBuf inter RAW distance=2 true
+#pragma HLS DEPENDENCE variable=inputBuf intra false
+        wr_word++;
+        wr_simd++;
+        if (wr_simd == multiplying_factor) {
+          wr_simd = 0;
+          wr_col++;
+        }
+        if (wr_word == line_length) {
+          wr_word = 0;
+          wr_col = 0;
+          wr_row++;
+          wr_line++;
+          if (wr_line == number_lines) {
+            wr_line = 0;
+          }
+        }
+      }
+    } // End base_iter
+  } // End count_image
+} // End generator
+
+/**
+ * \brief Sliding Window unit that produces output vectors for feeding
+ * a Matrix_Vector_Activate_Batch or a Vector_Vector_Activate_Batch, implementing the im2col algorithm
+ * for 3D (spatio-temporal) convolutions on clips of IFMDepth frames streamed in order.
+ *
+ * The buffer is a ring of the (ConvKernelDim_t-1)*Dilation_t+1 frames spanned by one window in time. As in
+ * ConvolutionInputGenerator_generic, input pixels and output words are scheduled independently: an output word
+ * is produced one cycle after its input pixel has been received, and an input pixel overwrites the buffered one of
+ * the same frame position as soon as no pending window needs it anymore. Frames not covered by any window are
+ * read and dropped. Kernel pixels are ordered (k_t, k_y, k_x), the output order is the one of
+ * ConvolutionInputGenerator (channels innermost) or, for DepthWise, the one of ConvolutionInputGenerator_dws.
+ *
+ * \tparam ConvKernelDim_t  Temporal dimension of the convolutional kernel
+ * \tparam ConvKernelDim    Spatial dimension of the convolutional kernel (assumed square)
+ * \tparam IFMChannels      Number of Input Feature Maps
+ * \tparam Input_precision  Number bits per pixel
+ * \tparam IFMDepth         Number of frames of the Input Feature Map
+ * \tparam IFMDim           Width and Heigth of the Input Feature Map (assumed square)
+ * \tparam OFMDepth         Number of frames of the Output Feature Map
+ * \tparam OFMDim           Width and Heigth of the Output Feature Map (assumed square)
+ * \tparam SIMD             Number of input columns computed in parallel
+ * \tparam Stride_t         Temporal stride of the convolutional kernel
+ * \tparam Stride           Spatial stride of the convolutional kernel
+ * \tparam Dilation_t       Temporal dilation of the convolutional kernel
+ * \tparam Dilation         Spatial dilation of the convolutional kernel
+ * \tparam DepthWise        Output order for Vector_Vector_Activate_Batch (channels outside of kernel pixels)
+ * \tparam R          	  Datatype for the resource used for FPGA implementation of the SWG  - safely deducible from the paramaters
+ *
+ * \param in                Input stream
+ * \param out               Output stream
+ * \param numReps           Number of time the function has to be repeatedly executed (e.g. number of clips)
+ * \param r			  Resource type for the hardware implementation of the memory block
+ */
+template<unsigned int ConvKernelDim_t,
+		 unsigned int ConvKernelDim,
+		 unsigned int IFMChannels,
+		 unsigned int Input_precision,
+		 unsigned int IFMDepth,
+		 unsigned int IFMDim,
+		 unsigned int OFMDepth,
+		 unsigned int OFMDim,
+		 unsigned int SIMD,
+		 unsigned int Stride_t,
+		 unsigned int Stride,
+		 unsigned int Dilation_t,
+		 unsigned int Dilation,
+		 bool DepthWise,
+		 typename R>
+void ConvolutionInputGenerator_3D(
+		hls::stream<ap_uint<SIMD*Input_precision> > & in,
+		hls::stream<ap_uint<SIMD*Input_precision> > & out,
+		const unsigned int numReps,
+		R const &r) {
+  static_assert(IFMChannels % SIMD == 0, "");
+  constexpr unsigned  multiplying_factor = IFMChannels/SIMD;
+  // frames and rows spanned by one (dilated) window
+  constexpr unsigned  number_frames = (ConvKernelDim_t - 1) * Dilation_t + 1;
+  constexpr unsigned  window_dim = (ConvKernelDim - 1) * Dilation + 1;
+  static_assert(IFMDepth >= number_frames, "");
+  static_assert(IFMDim >= window_dim, "");
+  static_assert(OFMDepth == (IFMDepth - number_frames)/Stride_t + 1, "");
+  static_assert(OFMDim == (IFMDim - window_dim)/Stride + 1, "");
+  constexpr unsigned  frame_size = IFMDim * IFMDim * multiplying_factor;
+  constexpr unsigned  stride_frames = Stride_t % number_frames;
+  // the cost model accounts for the declared buffer and at least one cycle per input and output word
+  typedef cost::ConvolutionInputGenerator_3D<ConvKernelDim_t, ConvKernelDim, IFMChannels, Input_precision, IFMDepth, IFMDim,
+    OFMDepth, OFMDim, SIMD, Stride_t, Stride, Dilation_t, Dilation>  KernelCost;
+  static_assert(KernelCost::buffer_bits == number_frames * frame_size * SIMD * Input_precision, "");
+  static_assert(KernelCost::cycles_per_image >= std::max(OFMDepth * OFMDim * OFMDim * ConvKernelDim_t * ConvKernelDim * ConvKernelDim * multiplying_factor, IFMDepth * frame_size), "");
+
+  ap_uint<SIMD*Input_precision> inputBuf[number_frames][frame_size];
+  memory_resource(inputBuf, r);
+
+  for (unsigned int count_image = 0; count_image < numReps; count_image++) {
+    // write side: position of the next input word, and the one at the start of the previous iteration
+    unsigned int wr_frame = 0, wr_slot = 0, wr_y = 0, wr_x = 0, wr_simd = 0, wr_word = 0, wr_frame_d = 0, wr_word_d = 0;
+    // read side: window origin and position of the next output word
+    unsigned int frame_base = 0, row_base = 0, col_base = 0, top_slot = 0, ofm_t = 0, ofm_y = 0, ofm_x = 0;
+    unsigned int rd_frame = 0, rd_slot = 0, rd_y = 0, rd_x = 0, k_t = 0, k_y = 0, k_x = 0, count_simd = 0;
+    bool done = false;
+    FINN_HLSLIB_COUNT_IMAGE();
+    while (!done || (wr_frame < IFMDepth)) {
+#pragma HLS pipeline style=flp II=1
+      FINN_HLSLIB_COUNT_ITERATION();
+      // a word is read at the earliest two iterations after it has been written
+      unsigned int const  rd_word = (rd_y * IFMDim + rd_x) * multiplying_factor + count_simd;
+      bool const  in_needed = !done && (rd_frame >= wr_frame_d) && ((rd_frame > wr_frame_d) || (rd_word >= wr_word_d));
+      wr_frame_d = wr_frame;
+      wr_word_d = wr_word;
+      // the buffered pixel is free once its frame is behind the window or, for the last window frame
+      // using it, all windows of the current output frame covering it have been produced; evaluated with
+      // the window of the start of the iteration, it is never the one read in the same iteration
+      bool const  in_free = (wr_frame < number_frames) || done || (wr_frame - number_frames < frame_base) ||
+        ((wr_frame - number_frames < frame_base + Stride_t) &&
+         ((wr_y < row_base) || ((wr_y < row_base + Stride) && (wr_x < col_base))));
+      if (!done && !in_needed) {
+        out.write(inputBuf[rd_slot][rd_word]);
+
+        // next output word, kernel pixels innermost for depthwise, channels innermost otherwise
+        bool  pixel_done = false;
+        bool  window_done = false;
+        if (DepthWise) {
+          k_x++;
+          rd_x += Dilation;
+          if (k_x == ConvKernelDim) {
+            k_x = 0;
+            rd_x = col_base;
+            k_y++;
+            rd_y += Dilation;
+            if (k_y == ConvKernelDim) {
+              k_y = 0;
+              rd_y = row_base;
+              window_done = true;
+            }
+          }
+        }
+        else {
+          count_simd++;
+          if (count_simd == multiplying_factor) {
+            count_simd = 0;
+            k_x++;
+            rd_x += Dilation;
+            if (k_x == ConvKernelDim) {
+              k_x = 0;
+              rd_x = col_base;
+              k_y++;
+              rd_y += Dilation;
+              if (k_y == ConvKernelDim) {
+                k_y = 0;
+                rd_y = row_base;
+                window_done = true;
+              }
+            }
+          }
+        }
+        if (window_done) {
+          k_t++;
+          rd_frame += Dilation_t;
+          rd_slot += Dilation_t;
+          if (rd_slot >= number_frames) {
+            rd_slot -= number_frames;
+          }
+          if (k_t == ConvKernelDim_t) {
+            k_t = 0;
+            rd_frame = frame_base;
+            rd_slot = top_slot;
+            if (DepthWise) {
+              count_simd++;
+              if (count_simd == multiplying_factor) {
+                count_simd = 0;
+                pixel_done = true;
+              }
+            }
+            else {
+              pixel_done = true;
+            }
+          }
+        }
+        if (pixel_done) {
+          ofm_x++;
+          col_base += Stride;
+          if (ofm_x == OFMDim) {
+            ofm_x = 0;
+            col_base = 0;
+            ofm_y++;
+            row_base += Stride;
+            if (ofm_y == OFMDim) {
+              ofm_y = 0;
+              row_base = 0;
+              ofm_t++;
+              frame_base += Stride_t;
+              top_slot += stride_frames;
+              if (top_slot >= number_frames) {
+                top_slot -= number_frames;
+              }
+              rd_frame = frame_base;
+              rd_slot = top_slot;
+              if (ofm_t == OFMDepth) {
+                done = true;
+              }
+            }
+          }
+          rd_y = row_base;
+          rd_x = col_base;
+        }
+      }
+
+      if ((wr_frame < IFMDepth) && in_free) {
+        ap_uint<SIMD*Input_precision> inElem;
+        inElem = in.read();
+        inputBuf[wr_slot][wr_word] = inElem;
+#pragma HLS DEPENDENCE variable=inputBuf inter RAW distance=2 true
+#pragma HLS DEPENDENCE variable=inputBuf intra false
+        wr_word++;
+        wr_simd++;
+        if (wr_simd == multiplying_factor) {
+          wr_simd = 0;
+          wr_x++;
+          if (wr_x == IFMDim) {
+            wr_x = 0;
+            wr_y++;
+          }
+        }
+        if (wr_word == frame_size) {
+          wr_word = 0;
+          wr_y = 0;
+          wr_frame++;
+          wr_slot++;
+          if (wr_slot == number_frames) {
+            wr_slot = 0;
+          }
+        }
+      }
+    } // End base_iter
+  } // End count_image
+} // End generator
+
 
 
 /**
@@ -1304,6 +2345,10 @@ void ConvolutionInputGenerator_NonSquare(
   const unsigned int max_cycles = std::max(cycles_write_block,cycles_read_block);
   const unsigned int baseIter = IFMDim_x * ConvKernelDim_y * multiplying_factor// Initial buffer
 			                  + OFMDim_y * std::max(cycles_write_block,cycles_read_block);
+  // the cost model accounts for the declared buffer and at least one cycle per input and output word
+  typedef cost::ConvolutionInputGenerator_NonSquare<ConvKernelDim_x, ConvKernelDim_y, IFMChannels, Input_precision, IFMDim_x, IFMDim_y, OFMDim_x, OFMDim_y, SIMD, Stride_x, Stride_y>  KernelCost;
+  static_assert(KernelCost::buffer_bits == number_blocks * Stride_x * IFMDim_x * multiplying_factor * SIMD * Input_precision, "");
+  static_assert(KernelCost::cycles_per_image >= std::max(OFMDim_x * OFMDim_y * ConvKernelDim_x * ConvKernelDim_y * multiplying_factor, IFMDim_x * IFMDim_y * multiplying_factor), "");
   unsigned int counter_internal_block = 0;
   unsigned int current_block_write = 0;
   unsigned int current_line = 0;
@@ -1438,6 +2483,10 @@ void ConvolutionInputGenerator_NonSquare_dws(
   const unsigned int max_cycles = std::max(cycles_write_block,cycles_read_block);
   const unsigned int baseIter = IFMDim_x * ConvKernelDim_y * multiplying_factor// Initial buffer
 			                  + OFMDim_y * std::max(cycles_write_block,cycles_read_block);
+  // the cost model accounts for the declared buffer and at least one cycle per input and output word
+  typedef cost::ConvolutionInputGenerator_NonSquare_dws<ConvKernelDim_x, ConvKernelDim_y, IFMChannels, Input_precision, IFMDim_x, IFMDim_y, OFMDim_x, OFMDim_y, SIMD, Stride_x, Stride_y>  KernelCost;
+  static_assert(KernelCost::buffer_bits == number_blocks * Stride_x * IFMDim_x * multiplying_factor * SIMD * Input_precision, "");
+  static_assert(KernelCost::cycles_per_image >= std::max(OFMDim_x * OFMDim_y * ConvKernelDim_x * ConvKernelDim_y * multiplying_factor, IFMDim_x * IFMDim_y * multiplying_factor), "");
   unsigned int counter_internal_block = 0;
   unsigned int current_block_write = 0;
   unsigned int current_line = 0;
@@ -1571,6 +2620,9 @@ void ConvolutionInputGenerator_NonSquare_Dilated(
   const unsigned int multiplying_factor = IFMChannels/SIMD;
   const unsigned int number_blocks = (ConvKernelDim_y*Dilation_y)/Stride_y + 1 ;
   ap_uint<SIMD*Input_precision> inputBuf[number_blocks][Stride_x * IFMDim_x * multiplying_factor];
+  static_assert(cost::ConvolutionInputGenerator_NonSquare_Dilated<ConvKernelDim_x, ConvKernelDim_y, IFMChannels, Input_precision, IFMDim_x, IFMDim_y,
+                OFMDim_x, OFMDim_y, SIMD, Stride_x, Stride_y, Dilation_x, Dilation_y>::buffer_bits ==
+                number_blocks * Stride_x * IFMDim_x * multiplying_factor * SIMD * Input_precision, "");
 
 #pragma HLS ARRAY_PARTITION variable=inputBuf complete dim=1
   memory_resource(inputBuf, r);
@@ -1665,58 +2717,433 @@ void ConvolutionInputGenerator_NonSquare_Dilated(
 
 /**
  * \brief Sliding Window unit that produces output vectors for feeding
- * a Matrix_Vector_Activate_Batch, implementing the im2col algorithm.
- * To be used only for 1D feature maps.
- * Feeds all pixels of the window in parallel for full SIMD unfolding of following layer.
- * NOTE: Currently restricted to: Stride = 1 and SIMD = IFMChannels
+ * a Matrix_Vector_Activate_Batch, implementing the im2col algorithm with support to multiple output pixels.
+ * To be used when kernel is not square and with dilation, the MMV pixels of an output word are
+ * consecutive along the x axis.
+ * NOTE: Dilation over the Y axis not yet supported, ConvKernelDim_y has to be a multiple of Stride_y
  *
- * \tparam ConvKernelDim    	Dimension of the convolutional kernel
+ * \tparam ConvKernelDim_x    	Dimension of the convolutional kernel - x axis
+ * \tparam ConvKernelDim_y    	Dimension of the convolutional kernel - y axis
  * \tparam IFMChannels      	Number of Input Feature Maps
  * \tparam Input_precision  	Number bits per pixel
- * \tparam IFMDim           	Height of the Input Feature Map
- * \tparam OFMDim           	Height of the Output Feature Map
- * \tparam Stride          	    Stride of the convolutional kernel
+ * \tparam IFMDim_x          	Width of the Input Feature Map
+ * \tparam IFMDim_y           	Height of the Input Feature Map
+ * \tparam OFMDim_x           	Width of the Output Feature Map
+ * \tparam OFMDim_y           	Height of the Output Feature Map
  * \tparam SIMD             	Number of input columns computed in parallel
+ * \tparam Stride_x           	Stride of the convolutional kernel - x axis
+ * \tparam Stride_y          	Stride of the convolutional kernel - y axis
+ * \tparam Dilation_x          	Dilation the convolutional kernel - x axis
+ * \tparam Dilation_y          	Dilation the convolutional kernel - y axis
+ * \tparam MMV              	Number of pixels that have to be produced in parallel
  * \tparam R          	  		Datatype for the resource used for FPGA implementation of the SWG  - safely deducible from the parameters
  *
  * \param in                	Input stream
  * \param out               	Output stream
  * \param numReps           	Number of time the function has to be repeatedly executed (e.g. number of images)
- * \param r			  			      Resource type for the hardware implementation of the memory block
-*/
-template<unsigned int ConvKernelDim,
+ * \param r			  			Resource type for the hardware implementation of the memory block
+ */
+template<unsigned int ConvKernelDim_x,
+		 unsigned int ConvKernelDim_y,
 		 unsigned int IFMChannels,
 		 unsigned int Input_precision,
-		 unsigned int IFMDim,
-		 unsigned int OFMDim,
-		 unsigned int Stride,
+		 unsigned int IFMDim_x,
+		 unsigned int IFMDim_y,
+		 unsigned int OFMDim_x,
+		 unsigned int OFMDim_y,
 		 unsigned int SIMD,
+		 unsigned int Stride_x,
+		 unsigned int Stride_y,
+		 unsigned int Dilation_x,
+		 unsigned int Dilation_y,
+		 unsigned int MMV,
 		 typename R>
-void ConvolutionInputGenerator_1D_parallel(
+void ConvolutionInputGenerator_NonSquare_Dilated_MMV(
 		hls::stream<ap_uint<SIMD*Input_precision> > & in,
-		hls::stream<ap_uint<ConvKernelDim*SIMD*Input_precision> > & out,
+		hls::stream<MultiChanData<MMV, SIMD*Input_precision> > & out,
 		const unsigned int numReps,
-		__attribute__((unused)) R const &r) {
-
-  static_assert(Stride == 1, "");
+		R const &r) {
   static_assert(IFMChannels % SIMD == 0, "");
-  constexpr unsigned  number_blocks = ConvKernelDim + 1 ;
-  constexpr unsigned  cycles_write_block = 1;
-  constexpr unsigned  cycles_read_block = 1;
-  constexpr unsigned  baseIter = ConvKernelDim // Initial buffer
-			                  + OFMDim * std::max(cycles_write_block,cycles_read_block);
-
-  ap_uint<SIMD*Input_precision> inputBuf[number_blocks];
-#pragma HLS ARRAY_PARTITION variable=inputBuf complete
-  //memory_resource(inputBuf, r); use reg regardless of setting
-
+  static_assert(OFMDim_x % MMV == 0, "");
+  static_assert(ConvKernelDim_y % Stride_y == 0, "");
+  static_assert(Dilation_y == 1, ""); // Dilation on the Y axes not yet supported, available only for API definition
+  static_assert(OFMDim_x == (IFMDim_x - (ConvKernelDim_x - 1) * Dilation_x - 1)/Stride_x + 1, "");
+  constexpr unsigned int multiplying_factor = IFMChannels/SIMD;
+  constexpr unsigned int number_blocks = ConvKernelDim_y/Stride_y + 1 ;
+  ap_uint<SIMD*Input_precision> inputBuf[MMV][number_blocks][Stride_y * IFMDim_x * multiplying_factor];
+#pragma HLS DEPENDENCE variable=inputBuf inter false
+#pragma HLS DEPENDENCE variable=inputBuf intra false
+#pragma HLS ARRAY_PARTITION variable=inputBuf complete dim=1
+#pragma HLS ARRAY_PARTITION variable=inputBuf complete dim=2
+  memory_resource(inputBuf, r);
+  constexpr unsigned int cycles_write_block = (OFMDim_x * ConvKernelDim_x * ConvKernelDim_y * multiplying_factor)/MMV;
+  constexpr unsigned int cycles_read_block = Stride_y * IFMDim_x * multiplying_factor;
+  constexpr unsigned int max_cycles = std::max(cycles_write_block,cycles_read_block);
+  const unsigned int baseIter = IFMDim_x * ConvKernelDim_y * multiplying_factor// Initial buffer
+			                  + OFMDim_y * std::max(cycles_write_block,cycles_read_block);
+  // the cost model accounts for the declared buffer and at least one cycle per input and output word
+  typedef cost::ConvolutionInputGenerator_NonSquare_Dilated_MMV<ConvKernelDim_x, ConvKernelDim_y, IFMChannels, Input_precision, IFMDim_x, IFMDim_y, OFMDim_x, OFMDim_y, SIMD, Stride_x, Stride_y, Dilation_x, Dilation_y, MMV>  KernelCost;
+  static_assert(KernelCost::buffer_bits == MMV * number_blocks * Stride_y * IFMDim_x * multiplying_factor * SIMD * Input_precision, "");
+  static_assert(KernelCost::cycles_per_image >= std::max(OFMDim_x * OFMDim_y * ConvKernelDim_x * ConvKernelDim_y * multiplying_factor / MMV, IFMDim_x * IFMDim_y * multiplying_factor), "");
+  unsigned int counter_internal_block = 0;
   unsigned int current_block_write = 0;
+  unsigned int current_line = 0;
   unsigned int read_block = 0;
-  unsigned int inp = 0, ofm_y = 0;
+  unsigned int inp = 0, ofm_y = 0, ofm_x = 0, k_y = 0, k_x = 0, count_simd =0;
+
   for (unsigned int count_image = 0; count_image < numReps; count_image++) {
     for (unsigned int i = 0; i < baseIter; i++) {
 #pragma HLS pipeline style=flp II=1
-      if (inp < ConvKernelDim) {// Initial buffer of ConvKernelDim lines
+      if (inp < IFMDim_x * ConvKernelDim_y *multiplying_factor) {// Initial buffer of ConvKernelDim_y lines
+        ap_uint<SIMD*Input_precision> inElem;
+        inElem = in.read();
+        for(unsigned int v = 0; v < MMV; v++) {
+#pragma HLS UNROLL
+          inputBuf[v][current_block_write][current_line] = inElem;
+        }
+        current_line++;
+        inp++;
+        if (current_line == Stride_y * IFMDim_x * multiplying_factor ) {
+          current_line = 0;
+          current_block_write++;
+          if (current_block_write == number_blocks) {
+            current_block_write=0;
+          }
+          read_block++;
+          counter_internal_block = 0;
+        }
+      } else {
+        if (counter_internal_block < cycles_write_block-1) { // We are writing output, MMV IFMChan per cycle
+          unsigned int current_block_read = (current_block_write + 1 + k_y / Stride_y);
+          if (current_block_read >= number_blocks) {
+            current_block_read-= number_blocks;
+          }
+          unsigned int current_line_in_block = ((k_y%Stride_y) * IFMDim_x + ofm_x*Stride_x + k_x*Dilation_x)*multiplying_factor + count_simd;
+          MultiChanData<MMV, SIMD*Input_precision> outElem;
+          // parallel read from all input buffers
+          for(unsigned int v = 0; v < MMV; v++) {
+#pragma HLS UNROLL
+            // each buffer's read addr is offset by its buffer index
+            outElem.data[v] = inputBuf[v][current_block_read][(current_line_in_block + v*Stride_x*multiplying_factor)];
+          }
+          out.write(outElem);
+          count_simd++;
+          if (count_simd == multiplying_factor) {
+            count_simd=0;
+            k_x++;
+            if (k_x == ConvKernelDim_x) {
+              k_x = 0;
+              k_y++;
+              if (k_y == ConvKernelDim_y) {
+                k_y = 0;
+                ofm_x += MMV;
+                if (ofm_x == OFMDim_x) {
+                  ofm_x = 0;
+                  ofm_y++;
+                  if (ofm_y == OFMDim_y) {
+                    ofm_y = 0;
+                    inp = 0;
+                  }
+                }
+              }
+            }
+          }
+        }
+        if ((counter_internal_block < cycles_read_block-1) && (read_block<IFMDim_y/Stride_y)) { // In parallel we write in the buffer, in the current block write if we still need to
+          ap_uint<SIMD*Input_precision> inElem;
+          inElem = in.read();
+          for(unsigned int v = 0; v < MMV; v++) {
+#pragma HLS UNROLL
+            inputBuf[v][current_block_write][current_line] = inElem;
+#pragma AP dependence variable=inputBuf intra false
+#pragma AP dependence variable=inputBuf inter false
+          }
+          current_line++;
+          if (current_line == Stride_y * IFMDim_x * multiplying_factor) {// We read the whole block, we change the next block in which we want to we
+            // We filled up a block, let's not read until
+            current_line = 0;
+            read_block++;
+            current_block_write++;
+            if (current_block_write == number_blocks) {
+              current_block_write=0;
+            }
+#pragma AP dependence variable=current_block_write intra false
+          }
+        }
+        counter_internal_block++; // = (counter_internal_block +1) % max_cycles;
+        if (counter_internal_block == (max_cycles-1)) {
+          counter_internal_block = 0;
+        }
+      }
+    } // End base_iter
+	read_block = 0;
+  } // End count_image
+} // End generator
+
+/**
+ * \brief Sliding Window unit that produces output vectors for feeding
+ * a Matrix_Vector_Activate_Batch, implementing the im2col algorithm with support to multiple output pixels.
+ * To be used when kernel is not square, the MMV pixels of an output word are consecutive along the x axis.
+ * NOTE: ConvKernelDim_y has to be a multiple of Stride_y
+ *
+ * \tparam ConvKernelDim_x    	Dimension of the convolutional kernel - x axis
+ * \tparam ConvKernelDim_y    	Dimension of the convolutional kernel - y axis
+ * \tparam IFMChannels      	Number of Input Feature Maps
+ * \tparam Input_precision  	Number bits per pixel
+ * \tparam IFMDim_x          	Width of the Input Feature Map
+ * \tparam IFMDim_y           	Height of the Input Feature Map
+ * \tparam OFMDim_x           	Width of the Output Feature Map
+ * \tparam OFMDim_y           	Height of the Output Feature Map
+ * \tparam SIMD             	Number of input columns computed in parallel
+ * \tparam Stride_x           	Stride of the convolutional kernel - x axis
+ * \tparam Stride_y          	Stride of the convolutional kernel - y axis
+ * \tparam MMV              	Number of pixels that have to be produced in parallel
+ * \tparam R          	  		Datatype for the resource used for FPGA implementation of the SWG  - safely deducible from the parameters
+ *
+ * \param in                	Input stream
+ * \param out               	Output stream
+ * \param numReps           	Number of time the function has to be repeatedly executed (e.g. number of images)
+ * \param r			  			Resource type for the hardware implementation of the memory block
+ */
+template<unsigned int ConvKernelDim_x,
+		 unsigned int ConvKernelDim_y,
+		 unsigned int IFMChannels,
+		 unsigned int Input_precision,
+		 unsigned int IFMDim_x,
+		 unsigned int IFMDim_y,
+		 unsigned int OFMDim_x,
+		 unsigned int OFMDim_y,
+		 unsigned int SIMD,
+		 unsigned int Stride_x,
+		 unsigned int Stride_y,
+		 unsigned int MMV,
+		 typename R>
+void ConvolutionInputGenerator_NonSquare_MMV(
+		hls::stream<ap_uint<SIMD*Input_precision> > & in,
+		hls::stream<MultiChanData<MMV, SIMD*Input_precision> > & out,
+		const unsigned int numReps,
+		R const &r) {
+#pragma HLS inline
+  ConvolutionInputGenerator_NonSquare_Dilated_MMV<ConvKernelDim_x, ConvKernelDim_y, IFMChannels, Input_precision,
+    IFMDim_x, IFMDim_y, OFMDim_x, OFMDim_y, SIMD, Stride_x, Stride_y, 1, 1, MMV>(in, out, numReps, r);
+}
+
+/**
+ * \brief Sliding Window unit that produces output vectors for feeding
+ * a Vector_Vector_Activate_Batch, implementing the im2col algorithm for depthwise separable convolutions with
+ * support to multiple output pixels. To be used when kernel is not square, the MMV pixels of an output word are
+ * consecutive along the x axis.
+ * NOTE: ConvKernelDim_y has to be a multiple of Stride_y
+ *
+ * \tparam ConvKernelDim_x    	Dimension of the convolutional kernel - x axis
+ * \tparam ConvKernelDim_y    	Dimension of the convolutional kernel - y axis
+ * \tparam IFMChannels      	Number of Input Feature Maps
+ * \tparam Input_precision  	Number bits per pixel
+ * \tparam IFMDim_x          	Width of the Input Feature Map
+ * \tparam IFMDim_y           	Height of the Input Feature Map
+ * \tparam OFMDim_x           	Width of the Output Feature Map
+ * \tparam OFMDim_y           	Height of the Output Feature Map
+ * \tparam SIMD             	Number of input columns computed in parallel
+ * \tparam Stride_x           	Stride of the convolutional kernel - x axis
+ * \tparam Stride_y          	Stride of the convolutional kernel - y axis
+ * \tparam MMV              	Number of pixels that have to be produced in parallel
+ * \tparam R          	  		Datatype for the resource used for FPGA implementation of the SWG  - safely deducible from the parameters
+ *
+ * \param in                	Input stream
+ * \param out               	Output stream
+ * \param numReps           	Number of time the function has to be repeatedly executed (e.g. number of images)
+ * \param r			  			Resource type for the hardware implementation of the memory block
+ */
+template<unsigned int ConvKernelDim_x,
+		 unsigned int ConvKernelDim_y,
+		 unsigned int IFMChannels,
+		 unsigned int Input_precision,
+		 unsigned int IFMDim_x,
+		 unsigned int IFMDim_y,
+		 unsigned int OFMDim_x,
+		 unsigned int OFMDim_y,
+		 unsigned int SIMD,
+		 unsigned int Stride_x,
+		 unsigned int Stride_y,
+		 unsigned int MMV,
+		 typename R>
+void ConvolutionInputGenerator_NonSquare_dws_MMV(
+		hls::stream<ap_uint<SIMD*Input_precision> > & in,
+		hls::stream<MultiChanData<MMV, SIMD*Input_precision> > & out,
+		const unsigned int numReps,
+		R const &r) {
+  static_assert(IFMChannels % SIMD == 0, "");
+  static_assert(OFMDim_x % MMV == 0, "");
+  static_assert(ConvKernelDim_y % Stride_y == 0, "");
+  static_assert(OFMDim_x == (IFMDim_x - ConvKernelDim_x)/Stride_x + 1, "");
+  constexpr unsigned int multiplying_factor = IFMChannels/SIMD;
+  constexpr unsigned int number_blocks = ConvKernelDim_y/Stride_y + 1 ;
+  ap_uint<SIMD*Input_precision> inputBuf[MMV][number_blocks][Stride_y * IFMDim_x * multiplying_factor];
+#pragma HLS DEPENDENCE variable=inputBuf inter false
+#pragma HLS DEPENDENCE variable=inputBuf intra false
+#pragma HLS ARRAY_PARTITION variable=inputBuf complete dim=1
+#pragma HLS ARRAY_PARTITION variable=inputBuf complete dim=2
+  memory_resource(inputBuf, r);
+  constexpr unsigned int cycles_write_block = (OFMDim_x * ConvKernelDim_x * ConvKernelDim_y * multiplying_factor)/MMV;
+  constexpr unsigned int cycles_read_block = Stride_y * IFMDim_x * multiplying_factor;
+  constexpr unsigned int max_cycles = std::max(cycles_write_block,cycles_read_block);
+  const unsigned int baseIter = IFMDim_x * ConvKernelDim_y * multiplying_factor// Initial buffer
+			                  + OFMDim_y * std::max(cycles_write_block,cycles_read_block);
+  // the cost model accounts for the declared buffer and at least one cycle per input and output word
+  typedef cost::ConvolutionInputGenerator_NonSquare_dws_MMV<ConvKernelDim_x, ConvKernelDim_y, IFMChannels, Input_precision, IFMDim_x, IFMDim_y, OFMDim_x, OFMDim_y, SIMD, Stride_x, Stride_y, MMV>  KernelCost;
+  static_assert(KernelCost::buffer_bits == MMV * number_blocks * Stride_y * IFMDim_x * multiplying_factor * SIMD * Input_precision, "");
+  static_assert(KernelCost::cycles_per_image >= std::max(OFMDim_x * OFMDim_y * ConvKernelDim_x * ConvKernelDim_y * multiplying_factor / MMV, IFMDim_x * IFMDim_y * multiplying_factor), "");
+  unsigned int counter_internal_block = 0;
+  unsigned int current_block_write = 0;
+  unsigned int current_line = 0;
+  unsigned int read_block = 0;
+  unsigned int inp = 0, ofm_y = 0, ofm_x = 0, k_y = 0, k_x = 0, count_simd =0;
+
+  for (unsigned int count_image = 0; count_image < numReps; count_image++) {
+    for (unsigned int i = 0; i < baseIter; i++) {
+#pragma HLS pipeline style=flp II=1
+      if (inp < IFMDim_x * ConvKernelDim_y *multiplying_factor) {// Initial buffer of ConvKernelDim_y lines
+        ap_uint<SIMD*Input_precision> inElem;
+        inElem = in.read();
+        for(unsigned int v = 0; v < MMV; v++) {
+#pragma HLS UNROLL
+          inputBuf[v][current_block_write][current_line] = inElem;
+        }
+        current_line++;
+        inp++;
+        if (current_line == Stride_y * IFMDim_x * multiplying_factor ) {
+          current_line = 0;
+          current_block_write++;
+          if (current_block_write == number_blocks) {
+            current_block_write=0;
+          }
+          read_block++;
+          counter_internal_block = 0;
+        }
+      } else {
+        if (counter_internal_block < cycles_write_block-1) { // We are writing output, MMV IFMChan per cycle
+          unsigned int current_block_read = (current_block_write + 1 + k_y / Stride_y);
+          if (current_block_read >= number_blocks) {
+            current_block_read-= number_blocks;
+          }
+          unsigned int current_line_in_block = ((k_y%Stride_y) * IFMDim_x + ofm_x*Stride_x + k_x)*multiplying_factor + count_simd;
+          MultiChanData<MMV, SIMD*Input_precision> outElem;
+          // parallel read from all input buffers
+          for(unsigned int v = 0; v < MMV; v++) {
+#pragma HLS UNROLL
+            // each buffer's read addr is offset by its buffer index
+            outElem.data[v] = inputBuf[v][current_block_read][(current_line_in_block + v*Stride_x*multiplying_factor)];
+          }
+          out.write(outElem);
+          k_x++;
+          if (k_x == ConvKernelDim_x) {
+            k_x = 0;
+            k_y++;
+            if (k_y == ConvKernelDim_y) {
+              k_y = 0;
+              count_simd++;
+              if (count_simd == multiplying_factor) {
+                count_simd=0;
+                ofm_x += MMV;
+                if (ofm_x == OFMDim_x) {
+                  ofm_x = 0;
+                  ofm_y++;
+                  if (ofm_y == OFMDim_y) {
+                    ofm_y = 0;
+                    inp = 0;
+                  }
+                }
+              }
+            }
+          }
+        }
+        if ((counter_internal_block < cycles_read_block-1) && (read_block<IFMDim_y/Stride_y)) { // In parallel we write in the buffer, in the current block write if we still need to
+          ap_uint<SIMD*Input_precision> inElem;
+          inElem = in.read();
+          for(unsigned int v = 0; v < MMV; v++) {
+#pragma HLS UNROLL
+            inputBuf[v][current_block_write][current_line] = inElem;
+#pragma AP dependence variable=inputBuf intra false
+#pragma AP dependence variable=inputBuf inter false
+          }
+          current_line++;
+          if (current_line == Stride_y * IFMDim_x * multiplying_factor) {// We read the whole block, we change the next block in which we want to we
+            // We filled up a block, let's not read until
+            current_line = 0;
+            read_block++;
+            current_block_write++;
+            if (current_block_write == number_blocks) {
+              current_block_write=0;
+            }
+#pragma AP dependence variable=current_block_write intra false
+          }
+        }
+        counter_internal_block++; // = (counter_internal_block +1) % max_cycles;
+        if (counter_internal_block == (max_cycles-1)) {
+          counter_internal_block = 0;
+        }
+      }
+    } // End base_iter
+	read_block = 0;
+  } // End count_image
+} // End generator
+
+/**
+ * \brief Sliding Window unit that produces output vectors for feeding
+ * a Matrix_Vector_Activate_Batch, implementing the im2col algorithm.
+ * To be used only for 1D feature maps.
+ * Feeds all pixels of the window in parallel for full SIMD unfolding of following layer.
+ * NOTE: Currently restricted to: Stride = 1 and SIMD = IFMChannels
+ *
+ * \tparam ConvKernelDim    	Dimension of the convolutional kernel
+ * \tparam IFMChannels      	Number of Input Feature Maps
+ * \tparam Input_precision  	Number bits per pixel
+ * \tparam IFMDim           	Height of the Input Feature Map
+ * \tparam OFMDim           	Height of the Output Feature Map
+ * \tparam Stride          	    Stride of the convolutional kernel
+ * \tparam SIMD             	Number of input columns computed in parallel
+ * \tparam R          	  		Datatype for the resource used for FPGA implementation of the SWG  - safely deducible from the parameters
+ *
+ * \param in                	Input stream
+ * \param out               	Output stream
+ * \param numReps           	Number of time the function has to be repeatedly executed (e.g. number of images)
+ * \param r			  			      Resource type for the hardware implementation of the memory block
+*/
+template<unsigned int ConvKernelDim,
+		 unsigned int IFMChannels,
+		 unsigned int Input_precision,
+		 unsigned int IFMDim,
+		 unsigned int OFMDim,
+		 unsigned int Stride,
+		 unsigned int SIMD,
+		 typename R>
+void ConvolutionInputGenerator_1D_parallel(
+		hls::stream<ap_uint<SIMD*Input_precision> > & in,
+		hls::stream<ap_uint<ConvKernelDim*SIMD*Input_precision> > & out,
+		const unsigned int numReps,
+		__attribute__((unused)) R const &r) {
+
+  static_assert(Stride == 1, "");
+  static_assert(IFMChannels % SIMD == 0, "");
+  constexpr unsigned  number_blocks = ConvKernelDim + 1 ;
+  constexpr unsigned  cycles_write_block = 1;
+  constexpr unsigned  cycles_read_block = 1;
+  constexpr unsigned  baseIter = ConvKernelDim // Initial buffer
+			                  + OFMDim * std::max(cycles_write_block,cycles_read_block);
+
+  ap_uint<SIMD*Input_precision> inputBuf[number_blocks];
+#pragma HLS ARRAY_PARTITION variable=inputBuf complete
+  static_assert(cost::ConvolutionInputGenerator_1D_parallel<ConvKernelDim, IFMChannels, Input_precision, IFMDim, OFMDim, Stride, SIMD>::buffer_bits ==
+                number_blocks * SIMD * Input_precision, "");
+  //memory_resource(inputBuf, r); use reg regardless of setting
+
+  unsigned int current_block_write = 0;
+  unsigned int read_block = 0;
+  unsigned int inp = 0, ofm_y = 0;
+  for (unsigned int count_image = 0; count_image < numReps; count_image++) {
+    for (unsigned int i = 0; i < baseIter; i++) {
+#pragma HLS pipeline style=flp II=1
+      if (inp < ConvKernelDim) {// Initial buffer of ConvKernelDim lines
         ap_uint<SIMD*Input_precision> inElem;
         inElem = in.read();
         inputBuf[current_block_write] = inElem;
@@ -1774,6 +3201,125 @@ void ConvolutionInputGenerator_1D_parallel(
   } // End count_image
 } // End generator
 
+/**
+ * \brief Sliding Window unit that produces output vectors for feeding
+ * a Matrix_Vector_Activate_Batch, implementing the im2col algorithm.
+ * Feeds all ConvKernelDim x ConvKernelDim pixels of the window in parallel for full SIMD unfolding
+ * of following layer: one input pixel is consumed and at most one window is produced per cycle.
+ * Kernel pixel (k_y, k_x) is placed at position k_y*ConvKernelDim + k_x of the output word.
+ * NOTE: Currently restricted to: SIMD = IFMChannels
+ *
+ * \tparam ConvKernelDim    	Dimension of the convolutional kernel (assumed square)
+ * \tparam IFMChannels      	Number of Input Feature Maps
+ * \tparam Input_precision  	Number bits per pixel
+ * \tparam IFMDim           	Width and Heigth of the Input Feature Map (assumed square)
+ * \tparam OFMDim           	Width and Heigth of the Output Feature Map (assumed square)
+ * \tparam Stride          	    Stride of the convolutional kernel
+ * \tparam SIMD             	Number of input columns computed in parallel
+ * \tparam R          	  		Datatype for the resource used for FPGA implementation of the SWG  - safely deducible from the parameters
+ *
+ * \param in                	Input stream
+ * \param out               	Output stream
+ * \param numReps           	Number of time the function has to be repeatedly executed (e.g. number of images)
+ * \param r			  			Resource type for the hardware implementation of the memory block
+*/
+template<unsigned int ConvKernelDim,
+		 unsigned int IFMChannels,
+		 unsigned int Input_precision,
+		 unsigned int IFMDim,
+		 unsigned int OFMDim,
+		 unsigned int Stride,
+		 unsigned int SIMD,
+		 typename R>
+void ConvolutionInputGenerator_parallel(
+		hls::stream<ap_uint<SIMD*Input_precision> > & in,
+		hls::stream<ap_uint<ConvKernelDim*ConvKernelDim*SIMD*Input_precision> > & out,
+		const unsigned int numReps,
+		R const &r) {
+
+  static_assert(IFMChannels == SIMD, "");
+  static_assert(OFMDim == (IFMDim - ConvKernelDim)/Stride + 1, "");
+  // the last ConvKernelDim-1 input rows, the current one is taken from the stream
+  constexpr unsigned  number_lines = (ConvKernelDim > 1)? ConvKernelDim - 1 : 1;
+
+  ap_uint<SIMD*Input_precision> lineBuf[number_lines][IFMDim];
+#pragma HLS ARRAY_PARTITION variable=lineBuf complete dim=1
+  memory_resource(lineBuf, r);
+  ap_uint<SIMD*Input_precision> window[ConvKernelDim][ConvKernelDim];
+#pragma HLS ARRAY_PARTITION variable=window complete dim=0
+  // the cost model accounts for the declared buffers and one cycle per input word
+  typedef cost::ConvolutionInputGenerator_parallel<ConvKernelDim, IFMChannels, Input_precision, IFMDim, OFMDim, Stride, SIMD>  KernelCost;
+  static_assert(KernelCost::buffer_bits == (number_lines * IFMDim + ConvKernelDim * ConvKernelDim) * SIMD * Input_precision, "");
+  static_assert(KernelCost::cycles_per_image >= IFMDim * IFMDim, "");
+
+  for (unsigned int count_image = 0; count_image < numReps; count_image++) {
+    unsigned int x = 0, y = 0;
+    unsigned int stride_x = 0, stride_y = 0;
+    for (unsigned int i = 0; i < IFMDim * IFMDim; i++) {
+#pragma HLS pipeline style=flp II=1
+      ap_uint<SIMD*Input_precision> inElem;
+      inElem = in.read();
+
+      // column of the window ending at the current pixel, oldest row first
+      ap_uint<SIMD*Input_precision> column[ConvKernelDim];
+#pragma HLS ARRAY_PARTITION variable=column complete
+      for (unsigned int k_y = 0; k_y < ConvKernelDim - 1; k_y++) {
+#pragma HLS UNROLL
+        column[k_y] = lineBuf[k_y][x];
+      }
+      column[ConvKernelDim - 1] = inElem;
+      for (unsigned int k_y = 0; k_y < ConvKernelDim - 1; k_y++) {
+#pragma HLS UNROLL
+        lineBuf[k_y][x] = column[k_y + 1];
+      }
+#pragma HLS DEPENDENCE variable=lineBuf inter false
+
+      // shift the window by one pixel
+      for (unsigned int k_y = 0; k_y < ConvKernelDim; k_y++) {
+#pragma HLS UNROLL
+        for (unsigned int k_x = 0; k_x < ConvKernelDim - 1; k_x++) {
+#pragma HLS UNROLL
+          window[k_y][k_x] = window[k_y][k_x + 1];
+        }
+        window[k_y][ConvKernelDim - 1] = column[k_y];
+      }
+
+      // a full window at a stride position is produced
+      if ((y >= ConvKernelDim - 1) && (x >= ConvKernelDim - 1) && (stride_y == 0) && (stride_x == 0)) {
+        ap_uint<ConvKernelDim*ConvKernelDim*SIMD*Input_precision> outElem;
+        for (unsigned int k_y = 0; k_y < ConvKernelDim; k_y++) {
+#pragma HLS UNROLL
+          for (unsigned int k_x = 0; k_x < ConvKernelDim; k_x++) {
+#pragma HLS UNROLL
+            unsigned int const k = k_y * ConvKernelDim + k_x;
+            outElem((k+1)*SIMD*Input_precision-1, k*SIMD*Input_precision) = window[k_y][k_x];
+          }
+        }
+        out.write(outElem);
+      }
+
+      if (x >= ConvKernelDim - 1) {
+        stride_x++;
+        if (stride_x == Stride) {
+          stride_x = 0;
+        }
+      }
+      x++;
+      if (x == IFMDim) {
+        x = 0;
+        stride_x = 0;
+        if (y >= ConvKernelDim - 1) {
+          stride_y++;
+          if (stride_y == Stride) {
+            stride_y = 0;
+          }
+        }
+        y++;
+      }
+    } // End base_iter
+  } // End count_image
+} // End generator
+
 /**
  * \brief Sliding Window unit that produces output vectors for feeding
  * a Vector_Vector_Activate_Batch, implementing the im2col algorithm. To be used with 1D kernels
@@ -1814,6 +3360,8 @@ void ConvolutionInputGenerator_1D_dws_naive(
   constexpr unsigned cycles_read_block = IFMDim_x * multiplying_factor;
   ap_uint<SIMD*Input_precision> inputBuf[cycles_read_block];
   memory_resource(inputBuf, r);
+  static_assert(cost::ConvolutionInputGenerator_1D_dws_naive<ConvKernelDim_x, IFMChannels, Input_precision, IFMDim_x, OFMDim_x, Stride_x, Dilation_x, SIMD>::buffer_bits ==
+                cycles_read_block * SIMD * Input_precision, "");
   constexpr unsigned baseIter = cycles_read_block // Initial buffer
 			                  + cycles_write_block;
   unsigned int current_line = 0;
@@ -1896,6 +3444,7 @@ void ConvolutionInputGenerator_1D(
 	constexpr unsigned  OCNT_INITIAL = BUFFER_SIZE + (Stride_x - 1);
 
 	ap_uint<SIMD*Input_precision>  buffer[BUFFER_SIZE];
+	static_assert(cost::ConvolutionInputGenerator_1D<ConvKernelDim_x, IFMChannels, Input_precision, IFMDim_x, OFMDim_x, Stride_x, SIMD>::buffer_bits == BUFFER_SIZE * SIMD * Input_precision, "");
 	memory_resource(buffer, r);
 
 	for(unsigned  count_image = 0; count_image < numReps; count_image++) {
@@ -1972,6 +3521,7 @@ void ConvolutionInputGenerator_1D_dws(
 	constexpr unsigned  READ_CYCLES = SIMD_COUNT * (ConvKernelDim_x- 1) - (ConvKernelDim_x - 1);
 
 	ap_uint<SIMD*Input_precision>  buffer[BUFFER_SIZE];
+	static_assert(cost::ConvolutionInputGenerator_1D_dws<ConvKernelDim_x, IFMChannels, Input_precision, IFMDim_x, OFMDim_x, SIMD>::buffer_bits == BUFFER_SIZE * SIMD * Input_precision, "");
 	memory_resource(buffer, r);
 
 	for(unsigned  count_image = 0; count_image < numReps; count_image++) {
@@ -2050,6 +3600,7 @@ void ConvolutionInputGenerator_1D_dws_stride(
 	constexpr unsigned  READ_CYCLES = SIMD_COUNT * (ConvKernelDim_x- 1) - (ConvKernelDim_x - 1);
 
 	ap_uint<SIMD*Input_precision>  buffer[BUFFER_SIZE];
+	static_assert(cost::ConvolutionInputGenerator_1D_dws_stride<ConvKernelDim_x, IFMChannels, Input_precision, IFMDim_x, OFMDim_x, Stride_x, SIMD>::buffer_bits == BUFFER_SIZE * SIMD * Input_precision, "");
 	memory_resource(buffer, r);
 
 	for(unsigned  count_image = 0; count_image < numReps; count_image++) {
@@ -0,0 +1,394 @@
+/******************************************************************************
+ *  Copyright (c) 2026, Advanced Micro Devices, Inc.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *
+ *  1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *
+ *  2.  Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ *  3.  Neither the name of the copyright holder nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION). HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ *  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************/
+/******************************************************************************
+ *
+ *  \file softmax.hpp
+ *
+ *  Library of templated HLS functions for QNN deployment.
+ *  Targeting softmax layers at the tail of the network
+ *
+ ******************************************************************************/
+
+#ifndef SOFTMAX_HPP
+#define SOFTMAX_HPP
+
+#include <ap_int.h>
+#include <hls_stream.h>
+
+#include "utils.hpp"
+#include "costmodel.hpp"
+
+/**
+ * \brief Compile-time lookup tables of Softmax_Batch
+ *
+ * m_exp2[k] = 2^(-k/2^LutBits), m_log2[k] = log2(1 + k/2^LutBits) and m_recip[k] = 1/(1 + k/2^LutBits),
+ * all with Frac fractional bits, in Frac+1 bits as m_exp2[0] = m_recip[0] = 1. m_recip has an extra entry
+ * for the mantissa 2 to interpolate between its entries. The entries are computed by constexpr functions and the kernels keep
+ * a static const instance, which is synthesized as ROMs.
+ *
+ * \tparam LutBits        Fractional input bits resolved by the tables (2^LutBits entries)
+ * \tparam Frac           Fractional bits of the table entries
+ */
+template<unsigned LutBits, unsigned Frac>
+struct SoftmaxTables {
+  static constexpr unsigned  SIZE = 1 << LutBits;
+  static constexpr double  LN2 = 0.69314718055994530942;
+
+  ap_uint<Frac + 1>  m_exp2[SIZE];
+  ap_uint<Frac + 1>  m_log2[SIZE];
+  ap_uint<Frac + 1>  m_recip[SIZE + 1];
+
+  // exp(x) for |x| <= ln(2) by its Taylor series
+  static constexpr double exp_small(double const  x) {
+    double  sum = 1.0;
+    double  term = 1.0;
+    for(unsigned  i = 1; i < 24; i++) {
+      term *= x / i;
+      sum += term;
+    }
+    return  sum;
+  }
+
+  // ln(1+f) for 0 <= f < 1 as 2*atanh(f/(2+f))
+  static constexpr double log1p_small(double const  f) {
+    double const  z = f / (2.0 + f);
+    double  sum = 0.0;
+    double  term = z;
+    for(unsigned  i = 1; i < 48; i += 2) {
+      sum += term / i;
+      term *= z * z;
+    }
+    return  2.0 * sum;
+  }
+
+  static constexpr unsigned long long exp2_entry(unsigned const  k) {
+    return  (unsigned long long)(exp_small(-double(k) / SIZE * LN2) * (1ull << Frac) + 0.5);
+  }
+  static constexpr unsigned long long log2_entry(unsigned const  k) {
+    return  (unsigned long long)(log1p_small(double(k) / SIZE) / LN2 * (1ull << Frac) + 0.5);
+  }
+  static constexpr unsigned long long recip_entry(unsigned const  k) {
+    return  (unsigned long long)(double(SIZE) / (SIZE + k) * (1ull << Frac) + 0.5);
+  }
+  static_assert(exp2_entry(0) < (2ull << Frac), "");
+  static_assert(log2_entry(SIZE - 1) < (2ull << Frac), "");
+
+  SoftmaxTables() {
+    for(unsigned  k = 0; k < SIZE; k++) {
+      m_exp2[k] = exp2_entry(k);
+      m_log2[k] = log2_entry(k);
+    }
+    for(unsigned  k = 0; k <= SIZE; k++) {
+      m_recip[k] = recip_entry(k);
+    }
+  }
+};
+
+/**
+ * \brief exp(x - max) with ExpBits fractional bits, for x <= max given with InFrac fractional bits
+ *
+ * Evaluated as 2^-t with t = (max - x)*log2(e): the integer part of t shifts the table entry of its fraction.
+ */
+template<typename InT, unsigned InFrac, unsigned ExpBits, unsigned LutBits>
+ap_uint<ExpBits + 1> softmax_exp(InT const &max, InT const &x) {
+#pragma HLS inline
+  constexpr unsigned  IN_W = InT::width;
+  constexpr unsigned  EXP_W = ExpBits + 1;
+  constexpr unsigned  LOG2E_FRAC = LutBits + 8;
+  constexpr unsigned long long  LOG2E = (unsigned long long)(1.44269504088896340736 * (1ull << LOG2E_FRAC) + 0.5);
+  constexpr unsigned  T_FRAC = InFrac + LOG2E_FRAC;
+  constexpr unsigned  T_W = IN_W + LOG2E_FRAC + 1;
+  static SoftmaxTables<LutBits, ExpBits> const  TABLES;
+
+  ap_uint<IN_W> const  d = max - x;
+  ap_uint<T_W> const  t = d * ap_uint<LOG2E_FRAC + 1>(LOG2E);
+  ap_uint<T_W> const  n = t >> T_FRAC;
+  ap_uint<LutBits> const  idx = t >> (T_FRAC - LutBits);
+  ap_uint<EXP_W> const  e = TABLES.m_exp2[idx];
+  return  n < EXP_W? ap_uint<EXP_W>(e >> n) : ap_uint<EXP_W>(0);
+}
+
+/**
+ * \brief Pass 1 of Softmax_Batch: forwards the input words of every pixel and its maximum
+ */
+template<unsigned NF, unsigned PE, typename InT>
+void softmax_max(hls::stream<ap_uint<PE * InT::width> > &in,
+                 hls::stream<ap_uint<PE * InT::width> > &words,
+                 hls::stream<InT> &maxima,
+                 unsigned const pixels) {
+  constexpr unsigned  IN_W = InT::width;
+  InT  lane_max[PE];
+#pragma HLS ARRAY_PARTITION variable=lane_max complete dim=1
+  unsigned  nf = 0;
+  for(unsigned  i = 0; i < pixels * NF; i++) {
+#pragma HLS pipeline style=flp II=1
+    ap_uint<PE * IN_W> const  inElem = in.read();
+    words.write(inElem);
+    for(unsigned  pe = 0; pe < PE; pe++) {
+#pragma HLS UNROLL
+      InT const  x = inElem((pe+1) * IN_W - 1, pe * IN_W);
+      if((nf == 0) || (x > lane_max[pe]))  lane_max[pe] = x;
+    }
+    if(++nf == NF) {
+      nf = 0;
+      InT  max = lane_max[0];
+      for(unsigned  pe = 1; pe < PE; pe++) {
+#pragma HLS UNROLL
+        if(lane_max[pe] > max)  max = lane_max[pe];
+      }
+      maxima.write(max);
+    }
+  }
+}
+
+/**
+ * \brief Pass 2 of Softmax_Batch: forwards the input words and the maximum of every pixel and
+ * the sum of exp(x - max) over its channels
+ */
+template<unsigned NF, unsigned PE, typename InT, unsigned InFrac, unsigned ExpBits, unsigned LutBits, unsigned SumBits>
+void softmax_sum(hls::stream<ap_uint<PE * InT::width> > &words_in,
+                 hls::stream<InT> &maxima_in,
+                 hls::stream<ap_uint<PE * InT::width> > &words_out,
+                 hls::stream<InT> &maxima_out,
+                 hls::stream<ap_uint<SumBits> > &sums,
+                 unsigned const pixels) {
+  constexpr unsigned  IN_W = InT::width;
+  InT  max;
+  ap_uint<SumBits>  sum;
+  unsigned  nf = 0;
+  for(unsigned  i = 0; i < pixels * NF; i++) {
+#pragma HLS pipeline style=flp II=1
+    if(nf == 0) {
+      max = maxima_in.read();
+      sum = 0;
+    }
+    ap_uint<PE * IN_W> const  inElem = words_in.read();
+    words_out.write(inElem);
+    ap_uint<SumBits>  part = 0;
+    for(unsigned  pe = 0; pe < PE; pe++) {
+#pragma HLS UNROLL
+      InT const  x = inElem((pe+1) * IN_W - 1, pe * IN_W);
+      part += softmax_exp<InT, InFrac, ExpBits, LutBits>(max, x);
+    }
+    sum += part;
+    if(++nf == NF) {
+      nf = 0;
+      maxima_out.write(max);
+      sums.write(sum);
+    }
+  }
+}
+
+/**
+ * \brief Normalization factors of Softmax_Batch, one pixel per cycle: the reciprocal of the sum, aligned
+ * to 2^(ExpBits+SumBits-1)/sum, and ln(sum) with OutFrac fractional bits
+ *
+ * The sum is normalized to a mantissa in [1, 2). Its leading LutBits fractional bits index the tables of
+ * log2 and of the reciprocal of the mantissa, and the reciprocal is interpolated linearly with the
+ * remaining bits. The sum is at least exp(0), i.e. its most significant bit is at ExpBits or above.
+ */
+template<typename InT, unsigned OutFrac, unsigned ExpBits, unsigned LutBits, unsigned SumBits, unsigned LnBits>
+void softmax_factors(hls::stream<InT> &maxima_in,
+                     hls::stream<ap_uint<SumBits> > &sums,
+                     hls::stream<InT> &maxima_out,
+                     hls::stream<ap_uint<SumBits> > &recips,
+                     hls::stream<ap_uint<LnBits + OutFrac> > &logs,
+                     unsigned const pixels) {
+  constexpr unsigned  EXP_W = ExpBits + 1;
+  // fraction bits of the mantissa below the table index
+  constexpr unsigned  IP_W = SumBits - 1 - LutBits;
+  // ln(2) scaling log2(sum) to the output
+  constexpr unsigned  LN2_FRAC = 16;
+  constexpr unsigned long long  LN2 = (unsigned long long)(0.69314718055994530942 * (1ull << LN2_FRAC) + 0.5);
+  static_assert(OutFrac < ExpBits + LN2_FRAC, "");
+  static SoftmaxTables<LutBits, ExpBits> const  TABLES;
+
+  for(unsigned  pixel = 0; pixel < pixels; pixel++) {
+#pragma HLS pipeline style=flp II=1
+    InT const  max = maxima_in.read();
+    ap_uint<SumBits> const  sum = sums.read();
+    unsigned  msb = 0;
+    for(unsigned  i = 0; i < SumBits; i++) {
+#pragma HLS UNROLL
+      if(sum[i])  msb = i;
+    }
+    ap_uint<SumBits> const  norm = sum << (SumBits - 1 - msb);
+    ap_uint<LutBits> const  mant = norm(SumBits - 2, IP_W);
+    ap_uint<IP_W> const  frac = norm(IP_W - 1, 0);
+
+    // 1/mantissa between the entries of mant and mant + 1, shifted by the exponent of the sum
+    ap_uint<EXP_W> const  r0 = TABLES.m_recip[mant];
+    ap_uint<EXP_W> const  r1 = TABLES.m_recip[ap_uint<LutBits + 1>(mant) + 1];
+    ap_uint<EXP_W + IP_W> const  step = ap_uint<EXP_W>(r0 - r1) * frac;
+    ap_uint<EXP_W> const  r = r0 - ap_uint<EXP_W>(step >> IP_W);
+    recips.write(ap_uint<SumBits>(r) << (SumBits - 1 - msb));
+
+    ap_uint<LnBits> const  log2_sum = (ap_uint<LnBits>(msb - ExpBits) << ExpBits) + TABLES.m_log2[mant];
+    ap_uint<LnBits + LN2_FRAC> const  ln_prod = log2_sum * ap_uint<LN2_FRAC>(LN2);
+    logs.write((ln_prod + (ap_uint<LnBits + LN2_FRAC>(1) << (ExpBits + LN2_FRAC - OutFrac - 1)))
+                 >> (ExpBits + LN2_FRAC - OutFrac));
+    maxima_out.write(max);
+  }
+}
+
+/**
+ * \brief Pass 3 of Softmax_Batch: normalizes the input words of every pixel with its maximum and
+ * normalization factors
+ */
+template<unsigned NF, unsigned PE, typename InT, typename OutT, unsigned InFrac, unsigned OutFrac,
+         bool LogSoftmax, unsigned ExpBits, unsigned LutBits, unsigned SumBits, unsigned LnBits>
+void softmax_normalize(hls::stream<ap_uint<PE * InT::width> > &words,
+                       hls::stream<InT> &maxima,
+                       hls::stream<ap_uint<SumBits> > &recips,
+                       hls::stream<ap_uint<LnBits + OutFrac> > &logs,
+                       hls::stream<ap_uint<PE * OutT::width> > &out,
+                       unsigned const pixels) {
+  constexpr unsigned  IN_W = InT::width;
+  constexpr unsigned  OUT_W = OutT::width;
+  constexpr unsigned  EXP_W = ExpBits + 1;
+  // exp(x - max) * recip carries ExpBits + SumBits - 1 fractional bits
+  constexpr unsigned  P_SHIFT = ExpBits + SumBits - 1 - OutFrac;
+  // output range
+  constexpr long long  OUT_MAX = OutT::sign_flag? (1ll << (OUT_W - 1)) - 1 : (1ll << OUT_W) - 1;
+  constexpr unsigned long long  OUT_NEG = 1ull << (OUT_W - 1);
+
+  InT  max;
+  ap_uint<SumBits>  recip;
+  ap_uint<LnBits + OutFrac>  ln_sum;
+  unsigned  nf = 0;
+  for(unsigned  i = 0; i < pixels * NF; i++) {
+#pragma HLS pipeline style=flp II=1
+    if(nf == 0) {
+      max = maxima.read();
+      recip = recips.read();
+      ln_sum = logs.read();
+    }
+    ap_uint<PE * IN_W> const  inElem = words.read();
+    ap_uint<PE * OUT_W>  outElem;
+    for(unsigned  pe = 0; pe < PE; pe++) {
+#pragma HLS UNROLL
+      InT const  x = inElem((pe+1) * IN_W - 1, pe * IN_W);
+      ap_uint<OUT_W>  y;
+      if(LogSoftmax) {
+        // -(max - x) - ln(sum), rounded to the output precision
+        ap_uint<IN_W + OutFrac + 1> const  d = ap_uint<IN_W + OutFrac + 1>(ap_uint<IN_W>(max - x)) << OutFrac;
+        ap_uint<IN_W + OutFrac + 1> const  ds = (d + ((ap_uint<IN_W + OutFrac + 1>(1) << InFrac) >> 1)) >> InFrac;
+        ap_uint<IN_W + OutFrac + LnBits + 1> const  neg = ds + ln_sum;
+        y = neg > OUT_NEG? ap_uint<OUT_W>(OUT_NEG) : ap_uint<OUT_W>(-ap_int<IN_W + OutFrac + LnBits + 2>(neg));
+      }
+      else {
+        // exp(x - max)/sum, rounded to the output precision
+        ap_uint<EXP_W> const  e = softmax_exp<InT, InFrac, ExpBits, LutBits>(max, x);
+        ap_uint<EXP_W + SumBits> const  p = e * recip + (ap_uint<EXP_W + SumBits>(1) << (P_SHIFT - 1));
+        ap_uint<EXP_W + SumBits - P_SHIFT> const  q = p >> P_SHIFT;
+        y = q > OUT_MAX? ap_uint<OUT_W>(OUT_MAX) : ap_uint<OUT_W>(q);
+      }
+      outElem((pe+1) * OUT_W - 1, pe * OUT_W) = y;
+    }
+    out.write(outElem);
+    if(++nf == NF)  nf = 0;
+  }
+}
+
+/**
+ * \brief Softmax (or log-softmax) over the channels of every pixel, in fixed-point arithmetic
+ *
+ * Inputs and outputs are fixed-point codes: an input x stands for x*2^-InFrac, an output y for y*2^-OutFrac.
+ * Every pixel goes through three passes over its NumChannels/PE input words: the maximum is found first,
+ * then exp(x - max) is accumulated, and finally every channel is normalized, i.e. exp(x - max) is multiplied
+ * by the reciprocal of the sum, or ln(sum) is subtracted from x - max for LogSoftmax. exp is evaluated as
+ * 2^-t, shifting a 2^LutBits-entry lookup table of 2^-frac(t); the reciprocal of the sum and ln(sum) use
+ * tables of 1/mantissa and log2(mantissa). Outputs saturate to the range of OutT, e.g. a probability of 1
+ * with an ap_uint<OutFrac> output.
+ *
+ * The passes are separate stages of the enclosing dataflow region, connected by FIFOs holding two pixels,
+ * so that every pass works on a different pixel and the layer accepts an input word per cycle.
+ *
+ * \tparam ImgDim         Total spatial size of the input feature map (e.g. 1 for a classifier)
+ * \tparam NumChannels    Number of channels (classes) normalized together
+ * \tparam PE             Number of channels computed in parallel
+ * \tparam InT            DataType of the input codes (ap_int or ap_uint)
+ * \tparam OutT           DataType of the output codes (ap_uint for probabilities, ap_int for LogSoftmax)
+ * \tparam InFrac         Fractional bits of the input
+ * \tparam OutFrac        Fractional bits of the output
+ * \tparam LogSoftmax     Produce log-probabilities instead of probabilities
+ * \tparam ExpBits        Fractional bits of exp(x - max) and of the internal logarithms
+ * \tparam LutBits        Fractional bits of the exponent resolved by the lookup tables
+ *
+ * \param in              Input stream
+ * \param out             Output stream
+ * \param reps            Number of time the function has to be repeatedly executed (e.g. number of images)
+ */
+template<
+  unsigned ImgDim, unsigned NumChannels, unsigned PE,
+  typename InT, typename OutT, unsigned InFrac, unsigned OutFrac,
+  bool LogSoftmax = false, unsigned ExpBits = 16, unsigned LutBits = 8
+>
+void Softmax_Batch(hls::stream<ap_uint<PE * InT::width> > &in,
+                   hls::stream<ap_uint<PE * OutT::width> > &out,
+                   int const reps) {
+#pragma HLS INLINE
+  static_assert(NumChannels % PE == 0, "");
+  static_assert(!LogSoftmax || OutT::sign_flag, "Log-probabilities need a signed output");
+  constexpr unsigned  NF = NumChannels / PE;
+
+  constexpr unsigned  IN_W = InT::width;
+  // exp(x - max) in [0, 1] and its sum over the channels
+  constexpr unsigned  SUM_W = ExpBits + 1 + clog2(NumChannels);
+  static_assert(SUM_W > LutBits + 1, "");
+  static_assert(OutFrac < ExpBits + SUM_W - 1, "");
+  constexpr unsigned  LN_W = clog2(clog2(NumChannels) + 1) + ExpBits + 1;
+  // the cost model accounts for the two FIFOs holding two pixels each and for a word per cycle
+  typedef cost::Softmax_Batch<ImgDim, NumChannels, PE, IN_W>  KernelCost;
+  constexpr unsigned  PixelDepth __attribute__((unused)) = 2 * NF;
+  static_assert(KernelCost::buffer_bits == 2 * PixelDepth * PE * IN_W, "");
+  static_assert(KernelCost::cycles_per_image >= ImgDim * NF, "");
+
+  unsigned const  pixels = reps * ImgDim;
+  hls::stream<ap_uint<PE * IN_W> >  words("Softmax_Batch.words");
+#pragma HLS STREAM variable=words depth=PixelDepth
+  hls::stream<ap_uint<PE * IN_W> >  sum_words("Softmax_Batch.sum_words");
+#pragma HLS STREAM variable=sum_words depth=PixelDepth
+  hls::stream<InT>  maxima("Softmax_Batch.maxima");
+  hls::stream<InT>  sum_maxima("Softmax_Batch.sum_maxima");
+  hls::stream<InT>  norm_maxima("Softmax_Batch.norm_maxima");
+  hls::stream<ap_uint<SUM_W> >  sums("Softmax_Batch.sums");
+  hls::stream<ap_uint<SUM_W> >  recips("Softmax_Batch.recips");
+  hls::stream<ap_uint<LN_W + OutFrac> >  logs("Softmax_Batch.logs");
+  softmax_max<NF, PE, InT>(in, words, maxima, pixels);
+  softmax_sum<NF, PE, InT, InFrac, ExpBits, LutBits, SUM_W>(words, maxima, sum_words, sum_maxima, sums, pixels);
+  softmax_factors<InT, OutFrac, ExpBits, LutBits, SUM_W, LN_W>(sum_maxima, sums, norm_maxima, recips, logs, pixels);
+  softmax_normalize<NF, PE, InT, OutT, InFrac, OutFrac, LogSoftmax, ExpBits, LutBits, SUM_W, LN_W>
+    (sum_words, norm_maxima, recips, logs, out, pixels);
+}
+
+#endif
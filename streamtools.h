@@ -49,6 +49,7 @@
 #define STREAMTOOLS_H
 
 #include "ap_axi_sdata.h"
+#include "utils.hpp"
 
 /**
  * \brief   Stream limiter - limits the number of stream packets
@@ -731,6 +732,110 @@ void AddStreamsLayer_Batch(hls::stream<ap_uint<NumChannels * In1_t::width>> &in1
   StreamingDataWidthConverter_Batch<PECount * Out_t::width, NumChannels * Out_t::width, NumTotal *(NumChannels / PECount)>(out_folded, out, numReps);
 }
 
+/**
+ * \brief   Channel Concatenation - Reads in N streams and writes their channels of each pixel, in order, to one output
+ *
+ * Used to merge the branches of Inception modules or the skip connections of U-Net. All streams share one PE, i.e.
+ * carry PE channels per word, and every channel count is a nonzero multiple of it, so the output is produced at II=1
+ * by forwarding the Channels/PE words of every input in turn, without buffering. Inputs of a different parallelism
+ * need a StreamingDataWidthConverter_Batch first.
+ *
+ * \tparam     N            Number of input streams
+ * \tparam     ImgDim       Total spatial size of the feature maps (e.g. ImgDim_x*ImgDim_y)
+ * \tparam     PE           Number of channels per stream word
+ * \tparam     T            Datatype of a channel
+ * \tparam     Channels     Number of channels of every input stream, in concatenation order
+ *
+ * \param      in           Input streams
+ * \param      out          Output stream
+ * \param      numReps      Number of frames / images
+ *
+ */
+template<unsigned int N,
+         unsigned int ImgDim,
+         unsigned int PE,
+         typename T,
+         unsigned int... Channels>
+void ConcatChannels_Batch(hls::stream<ap_uint<PE * T::width>> (&in)[N], hls::stream<ap_uint<PE * T::width>> &out,
+                          const unsigned int numReps) {
+  static_assert(sizeof...(Channels) == N, "Need one channel count per input stream");
+  static_assert(sum_of({(Channels == 0)...}) == 0, "Channel counts must be nonzero");
+  static_assert(sum_of({(Channels % PE)...}) == 0, "Channel counts must be multiples of PE");
+  constexpr unsigned int  NF[N] = { (Channels / PE)... };
+  constexpr unsigned int  TOTAL_FOLD = sum_of({(Channels / PE)...});
+
+  unsigned int  sel = 0;
+  unsigned int  nf = 0;
+  for (unsigned int i = 0; i < numReps * ImgDim * TOTAL_FOLD; i++) {
+#pragma HLS pipeline style=flp II=1
+    ap_uint<PE * T::width>  e;
+    for (unsigned int j = 0; j < N; j++) {
+#pragma HLS UNROLL
+      if (j == sel) {
+        e = in[j].read();
+      }
+    }
+    out.write(e);
+    if (++nf == NF[sel]) {
+      nf = 0;
+      if (++sel == N) {
+        sel = 0;
+      }
+    }
+  }
+}
+
+/**
+ * \brief   Channel Split - Reads in one stream and writes the channels of each pixel, in order, to N output streams
+ *
+ * Inverse of ConcatChannels_Batch, e.g. to feed the branches of a layer with grouped inputs. All streams share one
+ * PE, i.e. carry PE channels per word, and every channel count is a nonzero multiple of it, so the input is consumed
+ * at II=1 by forwarding its words to every output in turn, without buffering.
+ *
+ * \tparam     N            Number of output streams
+ * \tparam     ImgDim       Total spatial size of the feature maps (e.g. ImgDim_x*ImgDim_y)
+ * \tparam     PE           Number of channels per stream word
+ * \tparam     T            Datatype of a channel
+ * \tparam     Channels     Number of channels of every output stream, in split order
+ *
+ * \param      in           Input stream
+ * \param      out          Output streams
+ * \param      numReps      Number of frames / images
+ *
+ */
+template<unsigned int N,
+         unsigned int ImgDim,
+         unsigned int PE,
+         typename T,
+         unsigned int... Channels>
+void SplitChannels_Batch(hls::stream<ap_uint<PE * T::width>> &in, hls::stream<ap_uint<PE * T::width>> (&out)[N],
+                         const unsigned int numReps) {
+  static_assert(sizeof...(Channels) == N, "Need one channel count per output stream");
+  static_assert(sum_of({(Channels == 0)...}) == 0, "Channel counts must be nonzero");
+  static_assert(sum_of({(Channels % PE)...}) == 0, "Channel counts must be multiples of PE");
+  constexpr unsigned int  NF[N] = { (Channels / PE)... };
+  constexpr unsigned int  TOTAL_FOLD = sum_of({(Channels / PE)...});
+
+  unsigned int  sel = 0;
+  unsigned int  nf = 0;
+  for (unsigned int i = 0; i < numReps * ImgDim * TOTAL_FOLD; i++) {
+#pragma HLS pipeline style=flp II=1
+    ap_uint<PE * T::width> const  e = in.read();
+    for (unsigned int j = 0; j < N; j++) {
+#pragma HLS UNROLL
+      if (j == sel) {
+        out[j].write(e);
+      }
+    }
+    if (++nf == NF[sel]) {
+      nf = 0;
+      if (++sel == N) {
+        sel = 0;
+      }
+    }
+  }
+}
+
 
 /**
  * \brief   Stream Multi Chan Data Width Converter - Converts the width of the input stream in the output stream, working on multiple parallel streams
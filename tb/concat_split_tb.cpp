@@ -0,0 +1,119 @@
+/******************************************************************************
+ *  Copyright (c) 2026, Advanced Micro Devices, Inc.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *
+ *  1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *
+ *  2.  Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ *  3.  Neither the name of the copyright holder nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION). HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ *  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************/
+/******************************************************************************
+ *
+ *  \file concat_split_tb.cpp
+ *
+ *  Testbench for the ConcatChannels_Batch and SplitChannels_Batch layers
+ *
+ *****************************************************************************/
+
+#include <iostream>
+#include <cmath>
+#include <cstring>
+#include <hls_stream.h>
+#include <cstdlib>
+#define AP_INT_MAX_W 8191
+#include "ap_int.h"
+#include "bnn-library.h"
+using namespace hls;
+using namespace std;
+
+#include "concat_split_top.h"
+
+#define MAX_IMAGES 2
+
+int main()
+{
+    unsigned int const channels_in[NUM_IN] = { CHANNELS_IN };
+    unsigned int const channels_out[NUM_OUT] = { CHANNELS_OUT };
+    // concatenated channels of every pixel
+    static ELEM_T CONCAT[MAX_IMAGES*ImgDim][sum_of({CHANNELS_IN})];
+    stream<ap_uint<WIDTH> > input_stream[NUM_IN];
+    stream<ap_uint<WIDTH> > output_stream[NUM_OUT];
+
+    for (unsigned int pixel = 0; pixel < MAX_IMAGES*ImgDim; pixel++) {
+        unsigned int channel = 0;
+        for (unsigned int i = 0; i < NUM_IN; i++) {
+            for (unsigned int f = 0; f < channels_in[i]/PE; f++) {
+                ap_uint<WIDTH> input_pe = 0;
+                for (unsigned int pe = 0; pe < PE; pe++) {
+                    ELEM_T const input = (ELEM_T)(rand());
+                    CONCAT[pixel][channel++] = input;
+                    input_pe((pe+1)*ELEM_T::width-1, pe*ELEM_T::width) = input;
+                }
+                input_stream[i].write(input_pe);
+            }
+        }
+    }
+
+    Testbench_concat_split(input_stream, output_stream, MAX_IMAGES);
+
+    int err_counter = 0;
+    for (unsigned int pixel = 0; pixel < MAX_IMAGES*ImgDim; pixel++) {
+        unsigned int channel = 0;
+        for (unsigned int o = 0; o < NUM_OUT; o++) {
+            for (unsigned int f = 0; f < channels_out[o]/PE; f++) {
+                if (output_stream[o].empty()) {
+                    std::cout << "ERROR: Missing output data on stream " << o << std::endl;
+                    return err_counter + 1;
+                }
+                ap_uint<WIDTH> const outElem = output_stream[o].read();
+                for (unsigned int pe = 0; pe < PE; pe++) {
+                    ELEM_T const produced = outElem((pe+1)*ELEM_T::width-1, pe*ELEM_T::width);
+                    if (produced != CONCAT[pixel][channel]) {
+                        std::cout << "ERROR: Expected[" << pixel << "][" << channel << "]=" << CONCAT[pixel][channel]
+                                  << " actual " << produced << " on stream " << o << std::endl;
+                        err_counter++;
+                    }
+                    channel++;
+                }
+            }
+        }
+    }
+    for (unsigned int i = 0; i < NUM_IN; i++) {
+        if (!input_stream[i].empty()) {
+            std::cout << "ERROR: Input data left unread on stream " << i << std::endl;
+            err_counter++;
+        }
+    }
+    for (unsigned int o = 0; o < NUM_OUT; o++) {
+        if (!output_stream[o].empty()) {
+            std::cout << "ERROR: Unexpected output data on stream " << o << std::endl;
+            err_counter++;
+        }
+    }
+    if (err_counter == 0) {
+        std::cout << "Test passed." << std::endl;
+    }
+    return err_counter;
+}
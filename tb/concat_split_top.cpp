@@ -0,0 +1,50 @@
+/******************************************************************************
+ *  Copyright (c) 2026, Advanced Micro Devices, Inc.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *
+ *  1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *
+ *  2.  Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ *  3.  Neither the name of the copyright holder nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION). HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ *  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************/
+/******************************************************************************
+ *
+ *  \file concat_split_top.cpp
+ *
+ *  HLS Top function with a ConcatChannels_Batch layer followed by a
+ *  SplitChannels_Batch layer for unit testing
+ *
+ *****************************************************************************/
+
+#include "concat_split_top.h"
+
+void Testbench_concat_split(stream<ap_uint<WIDTH> > (&in)[NUM_IN], stream<ap_uint<WIDTH> > (&out)[NUM_OUT],
+                    unsigned int numReps){
+#pragma HLS DATAFLOW
+
+    hls::stream<ap_uint<WIDTH> > concat("concat");
+    ConcatChannels_Batch<NUM_IN, ImgDim, PE, ELEM_T, CHANNELS_IN>(in, concat, numReps);
+    SplitChannels_Batch<NUM_OUT, ImgDim, PE, ELEM_T, CHANNELS_OUT>(concat, out, numReps);
+}
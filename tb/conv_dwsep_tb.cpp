@@ -0,0 +1,119 @@
+/******************************************************************************
+ *  Copyright (c) 2026, Advanced Micro Devices, Inc.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *
+ *  1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *
+ *  2.  Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ *  3.  Neither the name of the copyright holder nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION). HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ *  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************/
+/******************************************************************************
+ *
+ *  \file conv_dwsep_tb.cpp
+ *
+ *  Testbench for the depthwise separable convolutional layer
+ *
+ *****************************************************************************/
+#include <iostream>
+#include <cmath>
+#include <ctime>
+#include <cstring>
+#include <hls_stream.h>
+#include <cstdlib>
+#define AP_INT_MAX_W 8191
+#include "ap_int.h"
+#include "bnn-library.h"
+
+#include "conv_dwsep_top.h"
+#include "data/memdata_dwsep.h"
+
+using namespace hls;
+using namespace std;
+
+#define MAX_IMAGES 2
+
+int main()
+{
+	static ap_int<INPUT_PRECISION> IMAGE[MAX_IMAGES][IFMDim1][IFMDim1][IFM_Channels1];
+	static int TEST[MAX_IMAGES][OFMDim1][OFMDim1][OFM_Channels1];
+	stream<ap_uint<IFM_Channels1*INPUT_PRECISION> > input_stream("input_stream");
+	stream<ap_uint<OFM_Channels1*ACTIVATION_PRECISION> > output_stream("output_stream");
+
+	for(unsigned n = 0; n < MAX_IMAGES; n++) {
+		for(unsigned y = 0; y < IFMDim1; y++) {
+			for(unsigned x = 0; x < IFMDim1; x++) {
+				ap_uint<IFM_Channels1*INPUT_PRECISION> inElem;
+				for(unsigned i = 0; i < IFM_Channels1; i++) {
+					IMAGE[n][y][x][i] = ap_int<INPUT_PRECISION>(rand());
+					inElem((i+1)*INPUT_PRECISION-1, i*INPUT_PRECISION) = IMAGE[n][y][x][i];
+				}
+				input_stream.write(inElem);
+			}
+		}
+	}
+
+	// reference: depthwise convolution followed by the pointwise one
+	static int MID[MAX_IMAGES][OFMDim1][OFMDim1][IFM_Channels1];
+	memset(MID, 0, sizeof(MID));
+	memset(TEST, 0, sizeof(TEST));
+	for(unsigned n = 0; n < MAX_IMAGES; n++)
+		for(unsigned oy = 0; oy < OFMDim1; oy++)
+			for(unsigned ox = 0; ox < OFMDim1; ox++) {
+				for(unsigned i = 0; i < IFM_Channels1; i++)
+					for(unsigned ky = 0; ky < KERNEL_DIM; ky++)
+						for(unsigned kx = 0; kx < KERNEL_DIM; kx++)
+							MID[n][oy][ox][i] += PARAM::dw_kernel[i][ky][kx] * IMAGE[n][oy*STRIDE+ky][ox*STRIDE+kx][i];
+				for(unsigned o = 0; o < OFM_Channels1; o++)
+					for(unsigned i = 0; i < IFM_Channels1; i++)
+						TEST[n][oy][ox][o] += PARAM::pw_kernel[o][i] * MID[n][oy][ox][i];
+			}
+
+	Testbench_conv_dwsep(input_stream, output_stream, MAX_IMAGES);
+
+	int err_counter = 0;
+	for(unsigned n = 0; n < MAX_IMAGES; n++) {
+		for(unsigned oy = 0; oy < OFMDim1; oy++) {
+			for(unsigned ox = 0; ox < OFMDim1; ox++) {
+				ap_uint<OFM_Channels1*ACTIVATION_PRECISION> outElem = output_stream.read();
+				for(unsigned o = 0; o < OFM_Channels1; o++) {
+					ap_int<ACTIVATION_PRECISION> const  out_chan = outElem((o+1)*ACTIVATION_PRECISION-1, o*ACTIVATION_PRECISION);
+					ap_int<ACTIVATION_PRECISION> const  EXP = TEST[n][oy][ox][o];
+					if(EXP != out_chan) {
+						std::cout << "ERROR: Expected[" << n << "][" << oy << "][" << ox << "][" << o << "]=" << EXP << " actual " << out_chan << std::endl;
+						err_counter++;
+					}
+				}
+			}
+		}
+	}
+	if(!output_stream.empty()) {
+		std::cout << "ERROR: Unexpected output data" << std::endl;
+		err_counter++;
+	}
+	if(err_counter == 0) {
+		std::cout << "Test passed." << std::endl;
+	}
+	return err_counter;
+}
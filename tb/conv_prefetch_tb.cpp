@@ -0,0 +1,194 @@
+/******************************************************************************
+ *  Copyright (c) 2026, Advanced Micro Devices, Inc.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *
+ *  1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *
+ *  2.  Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ *  3.  Neither the name of the copyright holder nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION). HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ *  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************/
+/******************************************************************************
+ *
+ *  \file conv_prefetch_tb.cpp
+ *
+ *  Testbench for the convolution HLS block with input prefetching
+ *
+ *****************************************************************************/
+#include <iostream>
+#include <cmath>
+#include <ctime>
+#include <cstring>
+#include <hls_stream.h>
+#include <cstdlib>
+#define AP_INT_MAX_W 8191
+#include "ap_int.h"
+#include "weights.hpp"
+#include "bnn-library.h"
+#include "conv_prefetch_top.h"
+#include "data/memdata.h"
+#include "activations.hpp"
+#include "interpret.hpp"
+#include "mvau.hpp"
+#include "conv.hpp"
+using namespace hls;
+using namespace std;
+
+#define MAX_IMAGES 2
+
+// Input stream refusing most non-blocking reads, as if the producer was slower
+// than the layer, so that vectors are only partly prefetched
+template<typename T>
+class StallingStream : public hls::stream<T> {
+	unsigned int m_count;
+public:
+	StallingStream(char const *name) : hls::stream<T>(name), m_count(0) {}
+	bool read_nb(T &val) {
+		if (++m_count % 10 != 0)
+			return false;
+		return hls::stream<T>::read_nb(val);
+	}
+};
+
+// Runs the layer of Testbench_conv_prefetch with a stalling input to the MVAU
+void Testbench_conv_prefetch_stall(stream<ap_uint<IFM_Channels1*INPUT_PRECISION> > & in, stream<ap_uint<OFM_Channels1*ACTIVATION_PRECISION> > & out, unsigned int numReps){
+	unsigned const MatrixW = KERNEL_DIM * KERNEL_DIM * IFM_Channels1;
+	unsigned const MatrixH = OFM_Channels1;
+	unsigned const InpPerImage = IFMDim2*IFMDim2;
+
+	hls::stream<ap_uint<SIMD1*INPUT_PRECISION> > wa_in("wa_in");
+	StallingStream<ap_uint<SIMD1*INPUT_PRECISION> > convInp("convInp");
+	hls::stream<ap_uint<PE1*ACTIVATION_PRECISION> > mvOut("mvOut");
+
+	StreamingDataWidthConverter_Batch<IFM_Channels1*INPUT_PRECISION, SIMD1*INPUT_PRECISION, InpPerImage>(in, wa_in, numReps);
+	ConvolutionInputGenerator<KERNEL_DIM, IFM_Channels1, INPUT_PRECISION, IFMDim2, OFMDim2, SIMD1, 1>(wa_in, convInp, numReps, ap_resource_dflt());
+	Matrix_Vector_Activate_Prefetch_Batch<MatrixW, MatrixH, SIMD1, PE1, 1, Slice<ap_uint<INPUT_PRECISION> >, Slice<ap_int<ACTIVATION_PRECISION> >, Identity>
+		(convInp, mvOut, PARAM::weights, PassThroughActivation<ap_uint<16>>(), numReps * OFMDim2 * OFMDim2, ap_resource_dsp());
+	StreamingDataWidthConverter_Batch<PE1*ACTIVATION_PRECISION, OFM_Channels1*ACTIVATION_PRECISION, OFMDim2 * OFMDim2 * (OFM_Channels1 / PE1)>(mvOut, out, numReps);
+}
+
+int main()
+{
+	static	ap_uint<INPUT_PRECISION> IMAGE[MAX_IMAGES][IFMDim2*IFMDim2][IFM_Channels1];
+	static	ap_int<ACTIVATION_PRECISION> TEST[MAX_IMAGES][OFMDim2][OFMDim2][OFM_Channels1];
+	stream<ap_uint<IFM_Channels1*INPUT_PRECISION> > input_stream("input_stream");
+	stream<ap_uint<OFM_Channels1*ACTIVATION_PRECISION> > output_stream("output_stream");
+	stream<ap_uint<IFM_Channels1*INPUT_PRECISION> > input_stream_stall("input_stream_stall");
+	stream<ap_uint<OFM_Channels1*ACTIVATION_PRECISION> > output_stream_stall("output_stream_stall");
+	unsigned int counter = 0;
+	for (unsigned int n_image = 0; n_image < MAX_IMAGES; n_image++) {
+		for (unsigned int oy = 0; oy < IFMDim2; oy++) {
+			for (unsigned int ox = 0; ox < IFMDim2; ox++) {
+				ap_uint<INPUT_PRECISION*IFM_Channels1> input_channel = 0;
+				for(unsigned int channel = 0; channel < IFM_Channels1; channel++)
+				{
+					ap_uint<INPUT_PRECISION> input = (ap_uint<INPUT_PRECISION>)(counter);
+					IMAGE[n_image][oy*IFMDim2+ox][channel]= input;
+					input_channel = input_channel >> INPUT_PRECISION;
+					input_channel(IFM_Channels1*INPUT_PRECISION-1,(IFM_Channels1-1)*INPUT_PRECISION)=input;
+
+					counter++;
+				}
+				input_stream.write(input_channel);
+				input_stream_stall.write(input_channel);
+			}
+		}
+	}
+	static	ap_int<4> W1[OFM_Channels1][KERNEL_DIM][KERNEL_DIM][IFM_Channels1];
+	// initialize the weights
+	constexpr int TX = (IFM_Channels1*KERNEL_DIM*KERNEL_DIM) / SIMD1;
+	constexpr int TY = OFM_Channels1 / PE1;
+	unsigned int kx=0;
+	unsigned int ky=0;
+	unsigned int chan_count=0;
+	unsigned int out_chan_count=0;
+	for (unsigned int oy = 0; oy < TY; oy++) {
+		for(unsigned int pe=0;pe <PE1;pe++){
+			for (unsigned int ox = 0; ox <TX; ox++) {
+				for(unsigned int simd=0;simd<SIMD1;simd++){
+					W1[out_chan_count][kx][ky][chan_count] = PARAM::weights.weights(oy*TX + ox)[pe][simd];
+					chan_count++;
+				    if (chan_count==IFM_Channels1){
+				    	chan_count=0;
+						kx++;
+						if (kx==KERNEL_DIM){
+							kx=0;
+							ky++;
+							if (ky==KERNEL_DIM){
+								ky=0;
+						    	out_chan_count++;
+							    if (out_chan_count==OFM_Channels1){
+							    	out_chan_count=0;
+							    }
+						    }
+					    }
+					}
+				}
+			}
+		}
+	}
+	conv<MAX_IMAGES,IFMDim2,OFMDim2,IFM_Channels1,OFM_Channels1, KERNEL_DIM, 1, ap_uint<INPUT_PRECISION> >(IMAGE, W1, TEST);
+	Testbench_conv_prefetch(input_stream, output_stream, MAX_IMAGES);
+	Testbench_conv_prefetch_stall(input_stream_stall, output_stream_stall, MAX_IMAGES);
+	int err_counter = 0, err_perimage=0;
+	ap_int<ACTIVATION_PRECISION> out_chan;
+	for (unsigned int n_image = 0; n_image < MAX_IMAGES; n_image++) {
+		for (unsigned int oy = 0; oy < OFMDim2; oy++) {
+			for (unsigned int ox = 0; ox < OFMDim2; ox++) {
+				ap_uint<OFM_Channels1*ACTIVATION_PRECISION> outElem = output_stream.read();
+				ap_uint<OFM_Channels1*ACTIVATION_PRECISION> outElemStall = output_stream_stall.read();
+				for(unsigned int channel = 0; channel < OFM_Channels1; channel++){
+					ap_int<ACTIVATION_PRECISION> EXP = TEST[n_image][ox][oy][channel];
+					out_chan(ACTIVATION_PRECISION-1,0) = outElem((channel + 1)*ACTIVATION_PRECISION-1,channel*ACTIVATION_PRECISION);
+
+					if (EXP != out_chan){
+						std::cout << "ERROR: Expected["<<oy <<"]["<<ox<<"]["<<channel<<"]=" << EXP << " actual " <<  out_chan << std::endl;
+						err_counter ++;
+						err_perimage++;
+					}
+					out_chan(ACTIVATION_PRECISION-1,0) = outElemStall((channel + 1)*ACTIVATION_PRECISION-1,channel*ACTIVATION_PRECISION);
+					if (EXP != out_chan){
+						std::cout << "ERROR: Stalling input, Expected["<<oy <<"]["<<ox<<"]["<<channel<<"]=" << EXP << " actual " <<  out_chan << std::endl;
+						err_counter ++;
+						err_perimage++;
+					}
+				}
+			}
+		}
+		if(err_perimage == 0){
+			std::cout << "Image # " << n_image << " passed the testing."<< std::endl;
+		}
+		else{
+			err_perimage=0;
+			std::cout << "Image # " << n_image << " failed the testing."<< std::endl;
+		}
+	}
+	if(err_counter == 0){
+		return 0;
+	}
+	else{
+		return 1;
+	}
+
+}
@@ -0,0 +1,171 @@
+/******************************************************************************
+ *  Copyright (c) 2026, Advanced Micro Devices, Inc.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *
+ *  1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *
+ *  2.  Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ *  3.  Neither the name of the copyright holder nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION). HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ *  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************/
+/******************************************************************************
+ *
+ *  \file conv_runtime_tb.cpp
+ *
+ *  Testbench for the convolution HLS block with runtime-writable weights
+ *  and thresholds
+ *
+ *****************************************************************************/
+#include <iostream>
+#include <cmath>
+#include <ctime>
+#include <cstring>
+#include <hls_stream.h>
+#include <cstdlib>
+#define AP_INT_MAX_W 8191
+#include "ap_int.h"
+#include "weights.hpp"
+#include "bnn-library.h"
+#include "conv_runtime_top.h"
+#include "data/memdata.h"
+#include "activations.hpp"
+#include "interpret.hpp"
+#include "mvau.hpp"
+#include "conv.hpp"
+using namespace hls;
+using namespace std;
+
+#define MAX_IMAGES 2
+
+int main()
+{
+	static	ap_uint<INPUT_PRECISION> IMAGE[MAX_IMAGES][IFMDim1*IFMDim1][IFM_Channels1];
+	static	ap_int<ACTIVATION_PRECISION> TEST[MAX_IMAGES][OFMDim1][OFMDim1][OFM_Channels1];
+	static	ap_uint<PE1*SIMD1> WEIGHTS[BANKS1][TILE1];
+	static	ap_uint<PE1*NumTH1*ACTIVATION_PRECISION> THRESHOLDS[BANKS1][NF1];
+	int const THRESHOLD_INIT[NumTH1] = {150, 200, 230};
+	unsigned int counter = 0;
+	for (unsigned int n_image = 0; n_image < MAX_IMAGES; n_image++) {
+		for (unsigned int oy = 0; oy < IFMDim1; oy++) {
+			for (unsigned int ox = 0; ox < IFMDim1; ox++) {
+				for(unsigned int channel = 0; channel < IFM_Channels1; channel++)
+				{
+					IMAGE[n_image][oy*IFMDim1+ox][channel] = (ap_uint<INPUT_PRECISION>)(counter);
+					counter++;
+				}
+			}
+		}
+	}
+	static	ap_int<4> W1[OFM_Channels1][KERNEL_DIM][KERNEL_DIM][IFM_Channels1];
+	// initialize the weights
+	constexpr int TX = (IFM_Channels1*KERNEL_DIM*KERNEL_DIM) / SIMD1;
+	constexpr int TY = OFM_Channels1 / PE1;
+	unsigned int kx=0;
+	unsigned int ky=0;
+	unsigned int chan_count=0;
+	unsigned int out_chan_count=0;
+	for (unsigned int oy = 0; oy < TY; oy++) {
+		for(unsigned int pe=0;pe <PE1;pe++){
+			for (unsigned int ox = 0; ox <TX; ox++) {
+				for(unsigned int simd=0;simd<SIMD1;simd++){
+					W1[out_chan_count][kx][ky][chan_count] = PARAM::weights.weights(oy*TX + ox)[pe][simd];
+					chan_count++;
+				    if (chan_count==IFM_Channels1){
+				    	chan_count=0;
+						kx++;
+						if (kx==KERNEL_DIM){
+							kx=0;
+							ky++;
+							if (ky==KERNEL_DIM){
+								ky=0;
+						    	out_chan_count++;
+							    if (out_chan_count==OFM_Channels1){
+							    	out_chan_count=0;
+							    }
+						    }
+					    }
+					}
+				}
+			}
+		}
+	}
+	conv<MAX_IMAGES,IFMDim1,OFMDim1,IFM_Channels1,OFM_Channels1, KERNEL_DIM, 1, ap_uint<INPUT_PRECISION> >(IMAGE, W1, TEST);
+
+	int err_counter = 0;
+	for (unsigned int bank = 0; bank < BANKS1; bank++) {
+		// load the model into the selected bank, a different one into the others
+		for (unsigned int b = 0; b < BANKS1; b++) {
+			for (unsigned int pe = 0; pe < PE1; pe++) {
+				// all PE lanes of a tile and of a neuron fold are packed into one word
+				for (unsigned int tile = 0; tile < TILE1; tile++) {
+					ap_uint<SIMD1> const w = PARAM::weights.m_weights[pe][tile];
+					WEIGHTS[b][tile]((pe+1)*SIMD1-1, pe*SIMD1) = (b == bank)? w : ap_uint<SIMD1>(~w);
+				}
+				for (unsigned int nf = 0; nf < NF1; nf++) {
+					for (unsigned int t = 0; t < NumTH1; t++) {
+						ap_int<ACTIVATION_PRECISION> const th = (b == bank)? THRESHOLD_INIT[t] : 0;
+						THRESHOLDS[b][nf]((pe*NumTH1+t+1)*ACTIVATION_PRECISION-1, (pe*NumTH1+t)*ACTIVATION_PRECISION) = th;
+					}
+				}
+			}
+		}
+
+		stream<ap_uint<IFM_Channels1*INPUT_PRECISION> > input_stream("input_stream");
+		stream<ap_uint<OFM_Channels1*OUTPUT_PRECISION> > output_stream("output_stream");
+		for (unsigned int n_image = 0; n_image < MAX_IMAGES; n_image++) {
+			for (unsigned int px = 0; px < IFMDim1*IFMDim1; px++) {
+				ap_uint<INPUT_PRECISION*IFM_Channels1> input_channel = 0;
+				for(unsigned int channel = 0; channel < IFM_Channels1; channel++) {
+					input_channel((channel+1)*INPUT_PRECISION-1, channel*INPUT_PRECISION) = IMAGE[n_image][px][channel];
+				}
+				input_stream.write(input_channel);
+			}
+		}
+
+		Testbench_conv_runtime(input_stream, output_stream, WEIGHTS, THRESHOLDS, bank, MAX_IMAGES);
+
+		for (unsigned int n_image = 0; n_image < MAX_IMAGES; n_image++) {
+			for (unsigned int oy = 0; oy < OFMDim1; oy++) {
+				for (unsigned int ox = 0; ox < OFMDim1; ox++) {
+					ap_uint<OFM_Channels1*OUTPUT_PRECISION> outElem = output_stream.read();
+					for(unsigned int channel = 0; channel < OFM_Channels1; channel++){
+						unsigned EXP = 0;
+						for (unsigned int t = 0; t < NumTH1; t++) {
+							EXP += THRESHOLD_INIT[t] < TEST[n_image][ox][oy][channel];
+						}
+						ap_uint<OUTPUT_PRECISION> const out_chan = outElem((channel + 1)*OUTPUT_PRECISION-1,channel*OUTPUT_PRECISION);
+						if (EXP != out_chan){
+							std::cout << "ERROR: Bank " << bank << " Expected["<<oy <<"]["<<ox<<"]["<<channel<<"]=" << EXP << " actual " <<  out_chan << std::endl;
+							err_counter ++;
+						}
+					}
+				}
+			}
+		}
+		if (err_counter == 0) {
+			std::cout << "Bank # " << bank << " passed the testing." << std::endl;
+		}
+	}
+	return err_counter;
+}
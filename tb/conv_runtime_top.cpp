@@ -0,0 +1,75 @@
+/******************************************************************************
+ *  Copyright (c) 2026, Advanced Micro Devices, Inc.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *
+ *  1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *
+ *  2.  Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ *  3.  Neither the name of the copyright holder nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION). HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ *  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************/
+/******************************************************************************
+ *
+ *  \file conv_runtime_top.cpp
+ *
+ *  HLS Top function with a single convolutional layer with runtime-writable
+ *  weights and thresholds for unit testing
+ *
+ *****************************************************************************/
+#include "conv_runtime_top.h"
+#include "activations.hpp"
+#include "weights.hpp"
+#include "interpret.hpp"
+#include "mvau.hpp"
+
+void Testbench_conv_runtime(stream<ap_uint<IFM_Channels1*INPUT_PRECISION> > & in, stream<ap_uint<OFM_Channels1*OUTPUT_PRECISION> > & out,
+                            ap_uint<PE1*SIMD1> const (&weights)[BANKS1][TILE1],
+                            ap_uint<PE1*NumTH1*ACTIVATION_PRECISION> const (&thresholds)[BANKS1][NF1],
+                            unsigned int bank, unsigned int numReps){
+#pragma HLS INTERFACE s_axilite port=bank
+#pragma HLS INTERFACE bram port=weights
+#pragma HLS INTERFACE bram port=thresholds
+#pragma HLS DATAFLOW
+
+    unsigned const MatrixW = KERNEL_DIM * KERNEL_DIM * IFM_Channels1;
+    unsigned const MatrixH = OFM_Channels1;
+    unsigned const InpPerImage = IFMDim1*IFMDim1;
+
+    hls::stream<ap_uint<SIMD1*INPUT_PRECISION> > wa_in("wa_in");
+    hls::stream<ap_uint<SIMD1*INPUT_PRECISION> > convInp("convInp");
+    hls::stream<ap_uint<PE1*OUTPUT_PRECISION> > mvOut("mvOut");
+
+    RuntimeBinaryWeights<SIMD1, PE1, TILE1, BANKS1> const  rt_weights(weights, bank);
+    RuntimeThresholdsActivation<NF1, PE1, NumTH1, ap_int<ACTIVATION_PRECISION>, ap_uint<OUTPUT_PRECISION>, 0,
+                                comp::less<ap_int<ACTIVATION_PRECISION>, ap_int<ACTIVATION_PRECISION>>, BANKS1> const  rt_thresholds(thresholds, bank);
+
+    StreamingDataWidthConverter_Batch<IFM_Channels1*INPUT_PRECISION, SIMD1*INPUT_PRECISION, InpPerImage>(in, wa_in, numReps);
+    ConvolutionInputGenerator<KERNEL_DIM, IFM_Channels1, INPUT_PRECISION, IFMDim1, OFMDim1, SIMD1, 1>(wa_in, convInp, numReps, ap_resource_dflt());
+
+    Matrix_Vector_Activate_Batch<MatrixW, MatrixH, SIMD1, PE1, 1, Slice<ap_uint<INPUT_PRECISION> >, Slice<ap_uint<OUTPUT_PRECISION> >, Identity>
+    (convInp, mvOut, rt_weights, rt_thresholds, numReps * OFMDim1 * OFMDim1, ap_resource_dsp());
+
+    StreamingDataWidthConverter_Batch<PE1*OUTPUT_PRECISION, OFM_Channels1*OUTPUT_PRECISION, OFMDim1 * OFMDim1 * NF1>(mvOut, out, numReps);
+
+}
@@ -0,0 +1,78 @@
+/******************************************************************************
+ *  Copyright (c) 2026, Advanced Micro Devices, Inc.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *
+ *  1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *
+ *  2.  Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ *  3.  Neither the name of the copyright holder nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION). HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ *  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************/
+/******************************************************************************
+ *
+ *  \file conv_stream_mmv_top.cpp
+ *
+ *  HLS Top function with a single convolutional layer with streamed weights
+ *  and MMV for unit testing
+ *
+ *****************************************************************************/
+#include "conv_stream_mmv_top.h"
+#include "activations.hpp"
+#include "weights.hpp"
+#include "interpret.hpp"
+#include "dma.h"
+#include "mvau.hpp"
+#include "data/memdata.h"
+
+void Testbench_conv_stream_mmv(stream<ap_uint<IFM_Channels1*INPUT_PRECISION> > & in, stream<ap_uint<OFM_Channels1*ACTIVATION_PRECISION> > & out, unsigned int numReps){
+#pragma HLS DATAFLOW
+
+    unsigned const MatrixW = KERNEL_DIM * KERNEL_DIM * IFM_Channels1;
+    unsigned const MatrixH = OFM_Channels1;
+    unsigned const InpPerImage = IFMDim2*IFMDim2;
+    unsigned const mmvReps = (numReps * OFMDim2 * OFMDim2) / MMV2;
+
+    hls::stream<ap_uint<SIMD1*INPUT_PRECISION> > wa_in("wa_in");
+    hls::stream<MultiChanData<MMV2, SIMD1*INPUT_PRECISION> > convInp("convInp");
+    hls::stream<ap_uint<SIMD1*PE1*WIDTH> > paramStreamOut("paramStreamOut");
+    hls::stream<MultiChanData<MMV2, PE1*ACTIVATION_PRECISION> > mmv2dwc("mmv2dwc");
+    hls::stream<MultiChanData<MMV2, OFM_Channels1*ACTIVATION_PRECISION> > dwc2flat("dwc2flat");
+    hls::stream<ap_uint<MMV2*OFM_Channels1*ACTIVATION_PRECISION> > mvOut("mvOut");
+
+    // one weight tile is shared by MMV2 output pixels
+    GenParamStream<TILE1, SIMD1, PE1, WIDTH>(PARAM::weights, paramStreamOut, mmvReps);
+
+    StreamingDataWidthConverter_Batch<IFM_Channels1*INPUT_PRECISION, SIMD1*INPUT_PRECISION, InpPerImage>(in, wa_in, numReps);
+    ConvolutionInputGenerator_MMV<KERNEL_DIM, IFM_Channels1, INPUT_PRECISION, IFMDim2, OFMDim2, SIMD1, 1, MMV2>(wa_in, convInp, numReps, ap_resource_dflt());
+
+    Matrix_Vector_Activate_Stream_Batch<MatrixW, MatrixH, SIMD1, PE1, MMV2, Slice_mmv<ap_uint<INPUT_PRECISION>, MMV2>, Slice_mmv<ap_int<ACTIVATION_PRECISION>, MMV2>, Identity, ap_uint<WIDTH> >
+    (    static_cast<hls::stream<MultiChanData<MMV2, SIMD1*INPUT_PRECISION>>&>(convInp),
+         static_cast<hls::stream<MultiChanData<MMV2, PE1*ACTIVATION_PRECISION>>&>(mmv2dwc),
+         paramStreamOut, PassThroughActivation<ap_uint<16>>(), mmvReps, ap_resource_dsp()    );
+
+    MultiChanDataWidthConverter_Batch<PE1*ACTIVATION_PRECISION, OFM_Channels1*ACTIVATION_PRECISION, OFMDim2 * OFMDim2 * (OFM_Channels1 / PE1) / MMV2, MMV2>(mmv2dwc, dwc2flat, numReps);
+    FlattenMultiChanData<MMV2, OFM_Channels1*ACTIVATION_PRECISION>(dwc2flat, mvOut, mmvReps);
+    StreamingDataWidthConverter_Batch<MMV2*OFM_Channels1*ACTIVATION_PRECISION, OFM_Channels1*ACTIVATION_PRECISION, OFMDim2 * OFMDim2 / MMV2>(mvOut, out, numReps);
+
+}
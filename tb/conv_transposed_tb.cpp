@@ -0,0 +1,144 @@
+/******************************************************************************
+ *  Copyright (c) 2026, Advanced Micro Devices, Inc.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *
+ *  1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *
+ *  2.  Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ *  3.  Neither the name of the copyright holder nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION). HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ *  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************/
+/******************************************************************************
+ *
+ *  \file conv_transposed_tb.cpp
+ *
+ *  Testbench for the transposed convolutional layer
+ *
+ *****************************************************************************/
+#include <iostream>
+#include <cmath>
+#include <ctime>
+#include <cstring>
+#include <hls_stream.h>
+#include <cstdlib>
+#define AP_INT_MAX_W 8191
+#include "ap_int.h"
+#include "bnn-library.h"
+
+#include "conv_transposed_top.h"
+#include "data/memdata_transposed.h"
+
+using namespace hls;
+using namespace std;
+
+#define MAX_IMAGES 2
+
+template<unsigned IFMDim, unsigned IFMChannels>
+void generate_images(ap_int<INPUT_PRECISION> (&image)[MAX_IMAGES][IFMDim][IFMDim][IFMChannels],
+                     stream<ap_uint<IFMChannels*INPUT_PRECISION> > &input_stream) {
+	for(unsigned n = 0; n < MAX_IMAGES; n++) {
+		for(unsigned y = 0; y < IFMDim; y++) {
+			for(unsigned x = 0; x < IFMDim; x++) {
+				ap_uint<IFMChannels*INPUT_PRECISION> inElem;
+				for(unsigned i = 0; i < IFMChannels; i++) {
+					image[n][y][x][i] = ap_int<INPUT_PRECISION>(rand());
+					inElem((i+1)*INPUT_PRECISION-1, i*INPUT_PRECISION) = image[n][y][x][i];
+				}
+				input_stream.write(inElem);
+			}
+		}
+	}
+}
+
+// reference: every input pixel scatters the kernel onto the stride-expanded output, cropped by the padding
+template<unsigned KernelDim, unsigned Stride, unsigned Padding, unsigned IFMDim, unsigned OFMDim, unsigned IFMChannels, unsigned OFMChannels>
+void transposed_conv(ap_int<INPUT_PRECISION> const (&image)[MAX_IMAGES][IFMDim][IFMDim][IFMChannels],
+                     int const (&kernel)[OFMChannels][IFMChannels][KernelDim][KernelDim],
+                     int (&test)[MAX_IMAGES][OFMDim][OFMDim][OFMChannels]) {
+	memset(test, 0, sizeof(test));
+	for(unsigned n = 0; n < MAX_IMAGES; n++)
+		for(unsigned y = 0; y < IFMDim; y++)
+			for(unsigned x = 0; x < IFMDim; x++)
+				for(unsigned ky = 0; ky < KernelDim; ky++)
+					for(unsigned kx = 0; kx < KernelDim; kx++) {
+						int const oy = y*Stride + ky - Padding;
+						int const ox = x*Stride + kx - Padding;
+						if((oy < 0) || (oy >= (int)OFMDim) || (ox < 0) || (ox >= (int)OFMDim))
+							continue;
+						for(unsigned o = 0; o < OFMChannels; o++)
+							for(unsigned i = 0; i < IFMChannels; i++)
+								test[n][oy][ox][o] += kernel[o][i][ky][kx] * image[n][y][x][i];
+					}
+}
+
+template<unsigned OFMDim, unsigned OFMChannels>
+int check_outputs(int const (&test)[MAX_IMAGES][OFMDim][OFMDim][OFMChannels],
+                  stream<ap_uint<OFMChannels*ACTIVATION_PRECISION> > &output_stream, unsigned const layer) {
+	int err_counter = 0;
+	for(unsigned n = 0; n < MAX_IMAGES; n++) {
+		for(unsigned oy = 0; oy < OFMDim; oy++) {
+			for(unsigned ox = 0; ox < OFMDim; ox++) {
+				ap_uint<OFMChannels*ACTIVATION_PRECISION> outElem = output_stream.read();
+				for(unsigned o = 0; o < OFMChannels; o++) {
+					ap_int<ACTIVATION_PRECISION> const  out_chan = outElem((o+1)*ACTIVATION_PRECISION-1, o*ACTIVATION_PRECISION);
+					ap_int<ACTIVATION_PRECISION> const  EXP = test[n][oy][ox][o];
+					if(EXP != out_chan) {
+						std::cout << "ERROR: Layer " << layer << " Expected[" << n << "][" << oy << "][" << ox << "][" << o << "]=" << EXP << " actual " << out_chan << std::endl;
+						err_counter++;
+					}
+				}
+			}
+		}
+	}
+	if(!output_stream.empty()) {
+		std::cout << "ERROR: Layer " << layer << " unexpected output data" << std::endl;
+		err_counter++;
+	}
+	return err_counter;
+}
+
+int main()
+{
+	static ap_int<INPUT_PRECISION> IMAGE1[MAX_IMAGES][IFMDim1][IFMDim1][IFM_Channels1];
+	static ap_int<INPUT_PRECISION> IMAGE2[MAX_IMAGES][IFMDim2][IFMDim2][IFM_Channels2];
+	static int TEST1[MAX_IMAGES][OFMDim1][OFMDim1][OFM_Channels1];
+	static int TEST2[MAX_IMAGES][OFMDim2][OFMDim2][OFM_Channels2];
+	stream<ap_uint<IFM_Channels1*INPUT_PRECISION> > input_stream1("input_stream1");
+	stream<ap_uint<OFM_Channels1*ACTIVATION_PRECISION> > output_stream1("output_stream1");
+	stream<ap_uint<IFM_Channels2*INPUT_PRECISION> > input_stream2("input_stream2");
+	stream<ap_uint<OFM_Channels2*ACTIVATION_PRECISION> > output_stream2("output_stream2");
+
+	generate_images(IMAGE1, input_stream1);
+	generate_images(IMAGE2, input_stream2);
+	transposed_conv<KERNEL_DIM1, STRIDE1, PADDING1>(IMAGE1, PARAM::kernel1, TEST1);
+	transposed_conv<KERNEL_DIM2, STRIDE2, PADDING2>(IMAGE2, PARAM::kernel2, TEST2);
+
+	Testbench_conv_transposed(input_stream1, output_stream1, input_stream2, output_stream2, MAX_IMAGES);
+
+	int err_counter = check_outputs(TEST1, output_stream1, 1) + check_outputs(TEST2, output_stream2, 2);
+	if(err_counter == 0) {
+		std::cout << "Test passed." << std::endl;
+	}
+	return err_counter;
+}
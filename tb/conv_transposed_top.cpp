@@ -0,0 +1,56 @@
+/******************************************************************************
+ *  Copyright (c) 2026, Advanced Micro Devices, Inc.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *
+ *  1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *
+ *  2.  Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ *  3.  Neither the name of the copyright holder nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION). HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ *  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************/
+/******************************************************************************
+ *
+ *  \file conv_transposed_top.cpp
+ *
+ *  HLS Top function with two transposed convolutional layers, the kernel of
+ *  the second one not being a multiple of its stride
+ *
+ *****************************************************************************/
+#include "conv_transposed_top.h"
+#include "activations.hpp"
+#include "weights.hpp"
+#include "interpret.hpp"
+#include "mvau.hpp"
+#include "data/memdata_transposed.h"
+
+void Testbench_conv_transposed(stream<ap_uint<IFM_Channels1*INPUT_PRECISION> > & in1,
+                stream<ap_uint<OFM_Channels1*ACTIVATION_PRECISION> > & out1,
+                stream<ap_uint<IFM_Channels2*INPUT_PRECISION> > & in2,
+                stream<ap_uint<OFM_Channels2*ACTIVATION_PRECISION> > & out2, unsigned int numReps){
+#pragma HLS DATAFLOW
+    ConvTransposedLayer_Batch<KERNEL_DIM1, IFM_Channels1, IFMDim1, OFM_Channels1, OFMDim1, STRIDE1, SIMD1, PE1, Slice<ap_int<INPUT_PRECISION> >, Slice<ap_int<ACTIVATION_PRECISION> >, Identity>
+        (in1, out1, PARAM::weights1, PassThroughActivation<ap_int<ACTIVATION_PRECISION>>(), numReps, ap_resource_dsp());
+    ConvTransposedLayer_Batch<KERNEL_DIM2, IFM_Channels2, IFMDim2, OFM_Channels2, OFMDim2, STRIDE2, SIMD2, PE2, Slice<ap_int<INPUT_PRECISION> >, Slice<ap_int<ACTIVATION_PRECISION> >, Identity>
+        (in2, out2, PARAM::weights2, PassThroughActivation<ap_int<ACTIVATION_PRECISION>>(), numReps, ap_resource_dsp());
+}
@@ -0,0 +1,14 @@
+#define KERNEL_DIM 3 
+#define STRIDE 2 
+#define IFM_Channels1 8 
+#define OFM_Channels1 6 
+#define IFMDim1 9 
+#define OFMDim1 4 
+#define SIMD1 4 
+#define PE1 3 
+#define WIDTH 4 
+#define INPUT_PRECISION 4 
+#define MID_PRECISION 16 
+#define TILE_DW 18 
+#define TILE_PW 4 
+#define ACTIVATION_PRECISION 24 
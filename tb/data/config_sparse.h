@@ -0,0 +1,8 @@
+#define MatrixW1 32 
+#define MatrixH1 32 
+#define SIMD1 4 
+#define PE1 4 
+#define WIDTH 4 
+#define INPUT_PRECISION 4 
+#define NZ1 26 
+#define ACTIVATION_PRECISION 16 
@@ -0,0 +1,23 @@
+#define KERNEL_DIM1 4 
+#define STRIDE1 2 
+#define IFM_Channels1 4 
+#define OFM_Channels1 2 
+#define IFMDim1 4 
+#define OFMDim1 8 
+#define PADDING1 1 
+#define SIMD1 2 
+#define PE1 2 
+#define TILE1 32 
+#define WIDTH 4 
+#define INPUT_PRECISION 4 
+#define ACTIVATION_PRECISION 16 
+#define KERNEL_DIM2 3 
+#define STRIDE2 2 
+#define IFM_Channels2 4 
+#define OFM_Channels2 2 
+#define IFMDim2 4 
+#define OFMDim2 7 
+#define PADDING2 1 
+#define SIMD2 2 
+#define PE2 2 
+#define TILE2 32 
@@ -0,0 +1,120 @@
+#   Copyright (c) 2026, Advanced Micro Devices, Inc.
+#   All rights reserved.
+# 
+#   Redistribution and use in source and binary forms, with or without 
+#   modification, are permitted provided that the following conditions are met:
+#
+#   1.  Redistributions of source code must retain the above copyright notice, 
+#       this list of conditions and the following disclaimer.
+#
+#   2.  Redistributions in binary form must reproduce the above copyright 
+#       notice, this list of conditions and the following disclaimer in the 
+#       documentation and/or other materials provided with the distribution.
+#
+#   3.  Neither the name of the copyright holder nor the names of its 
+#       contributors may be used to endorse or promote products derived from 
+#       this software without specific prior written permission.
+#
+#   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+#   AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+#   THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR 
+#   PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
+#   CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, 
+#   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, 
+#   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+#   OR BUSINESS INTERRUPTION). HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+#   WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR 
+#   OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF 
+#   ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#  
+import random 
+
+outFileWeights = open("memdata_dwsep.h" , "wt")
+outFileConfig = open("config_dwsep.h" , "wt")
+
+random.seed(0)
+
+kernel_dim = 3
+stride = 2
+ifm_channels = 8
+ofm_channels = 6
+ifm_dimension = 9
+ofm_dimension = (ifm_dimension - kernel_dim) // stride + 1
+simd = 4
+pe = 3
+input_precision = 4
+mid_precision = 16
+activation_precision = 24
+w_precision = 4
+
+# depthwise: one kernel tap of simd channels per tile, pointwise: simd x pe block of the 1x1 kernel per tile
+tile_dw = (ifm_channels // simd) * kernel_dim * kernel_dim
+tile_pw = (ifm_channels // simd) * (ofm_channels // pe)
+
+def rand_weight():
+	return random.randint(-(1<<(w_precision-1)), (1<<(w_precision-1))-1)
+
+# dw_kernel[i][k_y][k_x] and pw_kernel[o][i]
+dw_kernel = [[[rand_weight() for kx in range(kernel_dim)] for ky in range(kernel_dim)] for i in range(ifm_channels)]
+pw_kernel = [[rand_weight() for i in range(ifm_channels)] for o in range(ofm_channels)]
+
+outFileConfig.write("#define KERNEL_DIM %d \n" % kernel_dim)
+outFileConfig.write("#define STRIDE %d \n" % stride)
+outFileConfig.write("#define IFM_Channels1 %d \n" % ifm_channels)
+outFileConfig.write("#define OFM_Channels1 %d \n" % ofm_channels)
+outFileConfig.write("#define IFMDim1 %d \n" % ifm_dimension)
+outFileConfig.write("#define OFMDim1 %d \n" % ofm_dimension)
+outFileConfig.write("#define SIMD1 %d \n" % simd)
+outFileConfig.write("#define PE1 %d \n" % pe)
+outFileConfig.write("#define WIDTH %d \n" % w_precision)
+outFileConfig.write("#define INPUT_PRECISION %d \n" % input_precision)
+outFileConfig.write("#define MID_PRECISION %d \n" % mid_precision)
+outFileConfig.write("#define TILE_DW %d \n" % tile_dw)
+outFileConfig.write("#define TILE_PW %d \n" % tile_pw)
+outFileConfig.write("#define ACTIVATION_PRECISION %d \n" % activation_precision)
+
+outFileConfig.close()
+outFileWeights.write("#ifndef PARAMS_HPP\n")
+outFileWeights.write("#define PARAMS_HPP\n")
+
+outFileWeights.write("namespace PARAM{ \n")
+outFileWeights.write("static FixedPointWeights<1,ap_int<%d>,%d,%d> dw_weights= {\n{\n" %(w_precision,simd,tile_dw))
+for p in range(simd):
+	outFileWeights.write("{ \n")
+	for t in range(tile_dw):
+		nf, tap = divmod(t, kernel_dim * kernel_dim)
+		ky, kx = divmod(tap, kernel_dim)
+		val = dw_kernel[nf*simd + p][ky][kx] & ((1<<w_precision)-1)
+		outFileWeights.write("\"%s\"" % hex(val))
+		if t!=tile_dw-1:
+			outFileWeights.write(",\n")
+	outFileWeights.write("} \n")
+	if p!=simd-1:
+		outFileWeights.write(",")
+outFileWeights.write("}\n};\n")
+
+outFileWeights.write("static FixedPointWeights<%d,ap_int<%d>,%d,%d> pw_weights= {\n{\n" %(simd,w_precision,pe,tile_pw))
+for p in range(pe):
+	outFileWeights.write("{ \n")
+	for t in range(tile_pw):
+		nf, sf = divmod(t, ifm_channels // simd)
+		val = 0
+		for s in range(simd):
+			val |= (pw_kernel[nf*pe + p][sf*simd + s] & ((1<<w_precision)-1)) << (s*w_precision)
+		outFileWeights.write("\"%s\"" % hex(val))
+		if t!=tile_pw-1:
+			outFileWeights.write(",\n")
+	outFileWeights.write("} \n")
+	if p!=pe-1:
+		outFileWeights.write(",")
+outFileWeights.write("}\n};\n")
+
+# original kernels for the reference convolution
+outFileWeights.write("static int const dw_kernel[%d][%d][%d] = {\n" % (ifm_channels, kernel_dim, kernel_dim))
+outFileWeights.write(",\n".join("{" + ",".join("{" + ",".join("%d" % v for v in row) + "}" for row in ch) + "}" for ch in dw_kernel))
+outFileWeights.write("\n};\n")
+outFileWeights.write("static int const pw_kernel[%d][%d] = {\n" % (ofm_channels, ifm_channels))
+outFileWeights.write(",\n".join("{" + ",".join("%d" % v for v in row) + "}" for row in pw_kernel))
+outFileWeights.write("\n};\n } \n")
+outFileWeights.write("#endif \n")
+outFileWeights.close()
@@ -0,0 +1,93 @@
+#   Copyright (c) 2026, Advanced Micro Devices, Inc.
+#   All rights reserved.
+# 
+#   Redistribution and use in source and binary forms, with or without 
+#   modification, are permitted provided that the following conditions are met:
+#
+#   1.  Redistributions of source code must retain the above copyright notice, 
+#       this list of conditions and the following disclaimer.
+#
+#   2.  Redistributions in binary form must reproduce the above copyright 
+#       notice, this list of conditions and the following disclaimer in the 
+#       documentation and/or other materials provided with the distribution.
+#
+#   3.  Neither the name of the copyright holder nor the names of its 
+#       contributors may be used to endorse or promote products derived from 
+#       this software without specific prior written permission.
+#
+#   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+#   AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+#   THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR 
+#   PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
+#   CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, 
+#   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, 
+#   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+#   OR BUSINESS INTERRUPTION). HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+#   WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR 
+#   OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF 
+#   ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#  
+import random 
+
+outFileWeights = open("memdata_sparse.h" , "wt")
+outFileConfig = open("config_sparse.h" , "wt")
+
+random.seed(0)
+
+matrix_w = 32
+matrix_h = 32
+simd = 4
+pe = 4
+input_precision = 4
+activation_precision = 16
+w_precision = 4
+# probability of a SIMD x PE weight tile to be pruned
+sparsity = 0.6
+
+nf = matrix_h // pe
+sf = matrix_w // simd
+
+# draw the non-zero tiles, leave one neuron fold without any
+tiles = [[t for t in range(sf) if (f != nf // 2) and (random.random() >= sparsity)] for f in range(nf)]
+offsets = [0]
+for f in range(nf):
+	offsets.append(offsets[-1] + len(tiles[f]))
+nz = offsets[-1]
+# cycles per input vector: the first neuron fold is dense, the others take one
+# cycle per stored tile, or one if they have none
+cycles = sf + sum(max(len(tiles[f]), 1) for f in range(1, nf))
+
+outFileConfig.write("#define MatrixW1 %d \n" % matrix_w)
+outFileConfig.write("#define MatrixH1 %d \n" % matrix_h)
+outFileConfig.write("#define SIMD1 %d \n" % simd)
+outFileConfig.write("#define PE1 %d \n" % pe)
+outFileConfig.write("#define WIDTH %d \n" % w_precision)
+outFileConfig.write("#define INPUT_PRECISION %d \n" % input_precision)
+outFileConfig.write("#define NZ1 %d \n" % nz)
+outFileConfig.write("#define ACTIVATION_PRECISION %d \n" % activation_precision)
+
+outFileConfig.close()
+outFileWeights.write("#ifndef PARAMS_HPP\n")
+outFileWeights.write("#define PARAMS_HPP\n")
+
+outFileWeights.write("namespace PARAM{ \n")
+outFileWeights.write("static SparseFixedPointWeights<%d,ap_int<%d>,%d,%d,%d,%d> weights= {\n{\n" %(simd,w_precision,pe,sf,nf,nz))
+
+for p in range(pe):
+	outFileWeights.write("{ \n")
+	for t in range(nz):
+		width = simd*w_precision;
+		val = random.randint(0, (1<<width)-1)
+		outFileWeights.write("\"%s\"" % hex(val))
+		if t!=nz-1:
+			outFileWeights.write(",\n")
+	outFileWeights.write("} \n")
+	if p!=pe-1:
+		outFileWeights.write(",")
+outFileWeights.write("},\n{")
+outFileWeights.write(",".join("%d" % t for f in range(nf) for t in tiles[f]))
+outFileWeights.write("},\n{")
+outFileWeights.write(",".join("%d" % o for o in offsets))
+outFileWeights.write("},\n%d\n};\n } \n" % cycles)
+outFileWeights.write("#endif \n")
+outFileWeights.close()
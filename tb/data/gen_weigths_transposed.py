@@ -0,0 +1,113 @@
+#   Copyright (c) 2026, Advanced Micro Devices, Inc.
+#   All rights reserved.
+# 
+#   Redistribution and use in source and binary forms, with or without 
+#   modification, are permitted provided that the following conditions are met:
+#
+#   1.  Redistributions of source code must retain the above copyright notice, 
+#       this list of conditions and the following disclaimer.
+#
+#   2.  Redistributions in binary form must reproduce the above copyright 
+#       notice, this list of conditions and the following disclaimer in the 
+#       documentation and/or other materials provided with the distribution.
+#
+#   3.  Neither the name of the copyright holder nor the names of its 
+#       contributors may be used to endorse or promote products derived from 
+#       this software without specific prior written permission.
+#
+#   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+#   AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, 
+#   THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR 
+#   PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR 
+#   CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, 
+#   EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, 
+#   PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+#   OR BUSINESS INTERRUPTION). HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, 
+#   WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR 
+#   OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF 
+#   ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#  
+import random 
+
+outFileWeights = open("memdata_transposed.h" , "wt")
+outFileConfig = open("config_transposed.h" , "wt")
+
+random.seed(0)
+
+outFileWeights.write("#ifndef PARAMS_HPP\n")
+outFileWeights.write("#define PARAMS_HPP\n")
+
+outFileWeights.write("namespace PARAM{ \n")
+
+# layer 1: kernel multiple of the stride, layer 2: kernel zero padded to ceil(kernel_dim/stride) taps per phase
+for (layer, kernel_dim, stride, padding) in [(1, 4, 2, 1), (2, 3, 2, 1)]:
+	ifm_channels = 4
+	ofm_channels = 2
+	ifm_dimension = 4
+	ofm_dimension = (ifm_dimension - 1) * stride + kernel_dim - 2 * padding
+	simd = 2
+	pe = 2
+	input_precision = 4
+	activation_precision = 16
+	w_precision = 4
+
+	# sub-pixel decomposition: taps per dimension of every phase
+	taps = (kernel_dim + stride - 1) // stride
+	matrix_w = taps * taps * ifm_channels
+	matrix_h = stride * stride * ofm_channels
+	tile = (matrix_w // simd) * (matrix_h // pe)
+
+	# kernel[o][i][k_y][k_x] of the transposed convolution
+	kernel = [[[[random.randint(-(1<<(w_precision-1)), (1<<(w_precision-1))-1) for kx in range(kernel_dim)] for ky in range(kernel_dim)] for i in range(ifm_channels)] for o in range(ofm_channels)]
+
+	# phase-decomposed weight matrix, see ConvolutionInputGenerator_Transposed
+	def weight(row, col):
+		p, o = divmod(row, ofm_channels)
+		p_y, p_x = divmod(p, stride)
+		t, i = divmod(col, ifm_channels)
+		t_y, t_x = divmod(t, taps)
+		k_y = (taps-1-t_y)*stride + p_y
+		k_x = (taps-1-t_x)*stride + p_x
+		return kernel[o][i][k_y][k_x] if (k_y < kernel_dim) and (k_x < kernel_dim) else 0
+
+	outFileConfig.write("#define KERNEL_DIM%d %d \n" % (layer, kernel_dim))
+	outFileConfig.write("#define STRIDE%d %d \n" % (layer, stride))
+	outFileConfig.write("#define IFM_Channels%d %d \n" % (layer, ifm_channels))
+	outFileConfig.write("#define OFM_Channels%d %d \n" % (layer, ofm_channels))
+	outFileConfig.write("#define IFMDim%d %d \n" % (layer, ifm_dimension))
+	outFileConfig.write("#define OFMDim%d %d \n" % (layer, ofm_dimension))
+	outFileConfig.write("#define PADDING%d %d \n" % (layer, padding))
+	outFileConfig.write("#define SIMD%d %d \n" % (layer, simd))
+	outFileConfig.write("#define PE%d %d \n" % (layer, pe))
+	outFileConfig.write("#define TILE%d %d \n" % (layer, tile))
+	if layer == 1:
+		outFileConfig.write("#define WIDTH %d \n" % w_precision)
+		outFileConfig.write("#define INPUT_PRECISION %d \n" % input_precision)
+		outFileConfig.write("#define ACTIVATION_PRECISION %d \n" % activation_precision)
+
+	outFileWeights.write("static FixedPointWeights<%d,ap_int<%d>,%d,%d> weights%d= {\n{\n" %(simd,w_precision,pe,tile,layer))
+
+	for p in range(pe):
+		outFileWeights.write("{ \n")
+		for t in range(tile):
+			nf, sf = divmod(t, matrix_w // simd)
+			val = 0
+			for s in range(simd):
+				val |= (weight(nf*pe + p, sf*simd + s) & ((1<<w_precision)-1)) << (s*w_precision)
+			outFileWeights.write("\"%s\"" % hex(val))
+			if t!=tile-1:
+				outFileWeights.write(",\n")
+		outFileWeights.write("} \n")
+		if p!=pe-1:
+			outFileWeights.write(",")
+	outFileWeights.write("}\n};\n")
+
+	# original kernel for the reference transposed convolution
+	outFileWeights.write("static int const kernel%d[%d][%d][%d][%d] = {\n" % (layer, ofm_channels, ifm_channels, kernel_dim, kernel_dim))
+	outFileWeights.write(",\n".join("{" + ",".join("{" + ",".join("{" + ",".join("%d" % v for v in row) + "}" for row in ch) + "}" for ch in oc) + "}" for oc in kernel))
+	outFileWeights.write("\n};\n")
+
+outFileConfig.close()
+outFileWeights.write(" } \n")
+outFileWeights.write("#endif \n")
+outFileWeights.close()
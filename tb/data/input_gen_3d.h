@@ -0,0 +1,63 @@
+/******************************************************************************
+ *  Copyright (c) 2026, Advanced Micro Devices, Inc.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *
+ *  1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *
+ *  2.  Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ *  3.  Neither the name of the copyright holder nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION). HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ *  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************/
+#define IFM_Channels 4
+#define SIMD 2
+#define IFMDepth 5
+#define IFMDim 5
+#define INPUT_PRECISION 16
+// unit strides
+#define KERNEL_DIM_T0 3
+#define KERNEL_DIM0 3
+#define STRIDE_T0 1
+#define STRIDE0 1
+#define DILATION_T0 1
+#define DILATION0 1
+#define OFMDepth0 3
+#define OFMDim0 3
+// strided, depthwise output order
+#define KERNEL_DIM_T1 2
+#define KERNEL_DIM1 3
+#define STRIDE_T1 2
+#define STRIDE1 2
+#define DILATION_T1 1
+#define DILATION1 1
+#define OFMDepth1 2
+#define OFMDim1 2
+// dilated
+#define KERNEL_DIM_T2 2
+#define KERNEL_DIM2 2
+#define STRIDE_T2 1
+#define STRIDE2 1
+#define DILATION_T2 2
+#define DILATION2 2
+#define OFMDepth2 3
+#define OFMDim2 3
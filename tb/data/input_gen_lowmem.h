@@ -0,0 +1,61 @@
+/******************************************************************************
+ *  Copyright (c) 2026, Advanced Micro Devices, Inc.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *
+ *  1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *
+ *  2.  Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ *  3.  Neither the name of the copyright holder nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION). HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ *  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************/
+#define IFM_Channels 4
+#define SIMD 2
+#define IFMDim 9
+#define INPUT_PRECISION 16
+// kernel multiple of the stride
+#define KERNEL_DIM0 3
+#define STRIDE0 1
+#define OFMDim0 7
+// kernel not a multiple of the stride
+#define KERNEL_DIM1 3
+#define STRIDE1 2
+#define OFMDim1 4
+// stride larger than the kernel, input rows not covered by any window
+#define KERNEL_DIM2 2
+#define STRIDE2 3
+#define OFMDim2 3
+// pointwise kernel
+#define KERNEL_DIM3 1
+#define STRIDE3 1
+#define OFMDim3 9
+// throughput on a larger image: kernel not a multiple of the stride, and kernel equal to the stride
+// with input rows not covered by any window and four SIMD groups per buffer word
+#define IFMDim_T 31
+#define KERNEL_DIM4 3
+#define STRIDE4 2
+#define OFMDim4 15
+#define KERNEL_DIM5 3
+#define STRIDE5 3
+#define OFMDim5 10
+#define PACKED5 4
@@ -0,0 +1,75 @@
+/******************************************************************************
+ *  Copyright (c) 2026, Advanced Micro Devices, Inc.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *
+ *  1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *
+ *  2.  Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ *  3.  Neither the name of the copyright holder nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION). HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ *  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************/
+#define IFM_Channels 4
+#define SIMD 2
+#define INPUT_PRECISION 16
+// 1xK kernel on a wide feature map
+#define KERNEL_DIM_X0 5
+#define KERNEL_DIM_Y0 1
+#define IFMDim_X0 16
+#define IFMDim_Y0 4
+#define STRIDE_X0 1
+#define STRIDE_Y0 1
+#define OFMDim_X0 12
+#define OFMDim_Y0 4
+#define MMV0 4
+// non-square kernel and stride
+#define KERNEL_DIM_X1 3
+#define KERNEL_DIM_Y1 2
+#define IFMDim_X1 17
+#define IFMDim_Y1 8
+#define STRIDE_X1 2
+#define STRIDE_Y1 2
+#define OFMDim_X1 8
+#define OFMDim_Y1 4
+#define MMV1 2
+// Kx1 kernel, depthwise output order
+#define KERNEL_DIM_X2 1
+#define KERNEL_DIM_Y2 3
+#define IFMDim_X2 8
+#define IFMDim_Y2 6
+#define STRIDE_X2 1
+#define STRIDE_Y2 1
+#define OFMDim_X2 8
+#define OFMDim_Y2 4
+#define MMV2 4
+// kernel dilated along the x axis
+#define KERNEL_DIM_X3 3
+#define KERNEL_DIM_Y3 2
+#define IFMDim_X3 16
+#define IFMDim_Y3 5
+#define STRIDE_X3 1
+#define STRIDE_Y3 1
+#define DILATION_X3 2
+#define OFMDim_X3 12
+#define OFMDim_Y3 4
+#define MMV3 3
@@ -0,0 +1,41 @@
+#ifndef PARAMS_HPP
+#define PARAMS_HPP
+namespace PARAM{ 
+static FixedPointWeights<3,ap_int<4>,8,3> weights= {
+{
+{ 
+"0x17",
+"0x774",
+"0x825"} 
+,{ 
+"0x62",
+"0x707",
+"0x631"} 
+,{ 
+"0x502",
+"0x525",
+"0x555"} 
+,{ 
+"0x651",
+"0x713",
+"0x517"} 
+,{ 
+"0x538",
+"0x326",
+"0x766"} 
+,{ 
+"0x346",
+"0x525",
+"0x25"} 
+,{ 
+"0x426",
+"0x454",
+"0x486"} 
+,{ 
+"0x452",
+"0x571",
+"0x851"} 
+}
+};
+ } 
+#endif 
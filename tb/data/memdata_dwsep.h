@@ -0,0 +1,122 @@
+#ifndef PARAMS_HPP
+#define PARAMS_HPP
+namespace PARAM{ 
+static FixedPointWeights<1,ap_int<4>,4,18> dw_weights= {
+{
+{ 
+"0x4",
+"0x5",
+"0x9",
+"0x0",
+"0x7",
+"0x4",
+"0x1",
+"0x7",
+"0x3",
+"0xf",
+"0x2",
+"0xa",
+"0xe",
+"0xf",
+"0xf",
+"0xc",
+"0x6",
+"0xa"} 
+,{ 
+"0xe",
+"0xc",
+"0x1",
+"0xc",
+"0xb",
+"0x0",
+"0xc",
+"0x1",
+"0xb",
+"0xa",
+"0x2",
+"0x7",
+"0xb",
+"0x1",
+"0x1",
+"0xb",
+"0x2",
+"0xe"} 
+,{ 
+"0xa",
+"0x2",
+"0x7",
+"0xb",
+"0x3",
+"0x5",
+"0x2",
+"0xe",
+"0x7",
+"0x1",
+"0x6",
+"0xa",
+"0x4",
+"0x2",
+"0xf",
+"0x1",
+"0xd",
+"0xe"} 
+,{ 
+"0x6",
+"0x0",
+"0x9",
+"0x8",
+"0xa",
+"0x4",
+"0x8",
+"0x7",
+"0x2",
+"0xd",
+"0x9",
+"0x0",
+"0x7",
+"0xa",
+"0xa",
+"0xc",
+"0xc",
+"0x9"} 
+}
+};
+static FixedPointWeights<4,ap_int<4>,3,4> pw_weights= {
+{
+{ 
+"0xf04a",
+"0x605e",
+"0xcb95",
+"0x8a9f"} 
+,{ 
+"0x2a37",
+"0xe27b",
+"0x4beb",
+"0x9b3a"} 
+,{ 
+"0xb08f",
+"0x2d3f",
+"0xbde8",
+"0x89e7"} 
+}
+};
+static int const dw_kernel[8][3][3] = {
+{{4,5,-7},{0,7,4},{1,7,3}},
+{{-2,-4,1},{-4,-5,0},{-4,1,-5}},
+{{-6,2,7},{-5,3,5},{2,-2,7}},
+{{6,0,-7},{-8,-6,4},{-8,7,2}},
+{{-1,2,-6},{-2,-1,-1},{-4,6,-6}},
+{{-6,2,7},{-5,1,1},{-5,2,-2}},
+{{1,6,-6},{4,2,-1},{1,-3,-2}},
+{{-3,-7,0},{7,-6,-6},{-4,-4,-7}}
+};
+static int const pw_kernel[6][8] = {
+{-6,4,0,-1,-2,5,0,6},
+{7,3,-6,2,-5,7,2,-2},
+{-1,-8,0,-5,-1,3,-3,2},
+{5,-7,-5,-4,-1,-7,-6,-8},
+{-5,-2,-5,4,-6,3,-5,-7},
+{-8,-2,-3,-5,7,-2,-7,-8}
+};
+ } 
+#endif 
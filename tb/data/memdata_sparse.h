@@ -0,0 +1,120 @@
+#ifndef PARAMS_HPP
+#define PARAMS_HPP
+namespace PARAM{ 
+static SparseFixedPointWeights<4,ap_int<4>,4,8,8,26> weights= {
+{
+{ 
+"0x37d6",
+"0x9a57",
+"0x9509",
+"0x3fe7",
+"0xaa5e",
+"0x680a",
+"0x9347",
+"0xe3d5",
+"0x2eea",
+"0xc511",
+"0xa253",
+"0x7bf5",
+"0x94a6",
+"0x5e24",
+"0x60f7",
+"0x5f9b",
+"0x10e1",
+"0x8526",
+"0xf3fb",
+"0x235f",
+"0x2dfd",
+"0x42ac",
+"0x4c91",
+"0x13c8",
+"0x2916",
+"0xc857"} 
+,{ 
+"0x8d1f",
+"0x7893",
+"0x6e2e",
+"0xd6be",
+"0x8ce8",
+"0xe6b0",
+"0xfc3d",
+"0xb6f8",
+"0x2a2c",
+"0xa60d",
+"0x3b0f",
+"0xf90f",
+"0xaba8",
+"0x6179",
+"0x7c6f",
+"0x84c",
+"0x8ac5",
+"0x3bf9",
+"0x70e0",
+"0xbe7e",
+"0x5749",
+"0xaa42",
+"0xda2d",
+"0x1fd7",
+"0x3382",
+"0x4aef"} 
+,{ 
+"0x7003",
+"0x1728",
+"0x25e2",
+"0xdab",
+"0x3fb7",
+"0x6085",
+"0x3d48",
+"0xc84c",
+"0x2edd",
+"0xbd82",
+"0x3b6a",
+"0x12a1",
+"0xb13",
+"0x63a1",
+"0x5eb4",
+"0x3f6f",
+"0xf55e",
+"0x6bd0",
+"0x1f46",
+"0xbaa",
+"0xd9ea",
+"0x33f7",
+"0x8514",
+"0x23d7",
+"0x7110",
+"0x24d9"} 
+,{ 
+"0x9a24",
+"0xb359",
+"0xdf44",
+"0x5c52",
+"0x1f40",
+"0xef2b",
+"0x1429",
+"0x33ab",
+"0xc855",
+"0x6611",
+"0x8530",
+"0xb794",
+"0xf0c0",
+"0x56be",
+"0x6825",
+"0x1db8",
+"0x5100",
+"0x52eb",
+"0xaf43",
+"0x805a",
+"0x3c03",
+"0xe276",
+"0x5981",
+"0x6c2",
+"0xf178",
+"0xd1df"} 
+},
+{0,1,6,2,5,6,0,1,2,3,5,6,7,3,4,5,7,1,4,6,7,2,5,1,2,7},
+{0,3,6,13,17,17,21,23,26},
+32
+};
+ } 
+#endif 
@@ -0,0 +1,153 @@
+#ifndef PARAMS_HPP
+#define PARAMS_HPP
+namespace PARAM{ 
+static FixedPointWeights<2,ap_int<4>,2,32> weights1= {
+{
+{ 
+"0x7c",
+"0x2c",
+"0x23",
+"0xaf",
+"0xa9",
+"0x17",
+"0x14",
+"0xb4",
+"0x61",
+"0xf6",
+"0xee",
+"0x4f",
+"0x20",
+"0xb2",
+"0xb5",
+"0x18",
+"0x80",
+"0xe2",
+"0xc",
+"0x1a",
+"0x31",
+"0x1a",
+"0x77",
+"0x2f",
+"0xac",
+"0xd7",
+"0x9b",
+"0xda",
+"0x57",
+"0x6e",
+"0xb4",
+"0xe2"} 
+,{ 
+"0x0",
+"0xb",
+"0xfa",
+"0x5b",
+"0xa7",
+"0xdb",
+"0x79",
+"0x85",
+"0xbf",
+"0xa4",
+"0x84",
+"0xbe",
+"0x2a",
+"0xbc",
+"0x30",
+"0xe9",
+"0xd0",
+"0x1b",
+"0xfe",
+"0xfa",
+"0x2c",
+"0x9a",
+"0xba",
+"0x7f",
+"0x26",
+"0x39",
+"0x35",
+"0xa3",
+"0xe9",
+"0x88",
+"0x7c",
+"0xe9"} 
+}
+};
+static int const kernel1[2][4][4][4] = {
+{{{4,5,-7,0},{7,4,1,7},{3,-2,-4,1},{-4,-5,0,-4}},{{1,-5,-6,2},{7,-5,3,5},{2,-2,7,6},{0,-7,-8,-6}},{{4,-8,7,2},{-1,2,-6,-2},{-1,-1,-4,6},{-6,-6,2,7}},{{-5,1,1,-5},{2,-2,1,6},{-6,4,2,-1},{1,-3,-2,-3}}},
+{{{-7,0,7,-6},{-6,-4,-4,-7},{-6,4,0,-1},{-2,5,0,6}},{{7,3,-6,2},{-5,7,2,-2},{-1,-8,0,-5},{-1,3,-3,2}},{{5,-7,-5,-4},{-1,-7,-6,-8},{-5,-2,-5,4},{-6,3,-5,-7}},{{-8,-2,-3,-5},{7,-2,-7,-8},{5,-5,0,-6},{-1,-6,1,3}}}
+};
+static FixedPointWeights<2,ap_int<4>,2,32> weights2= {
+{
+{ 
+"0x0",
+"0xc4",
+"0xd4",
+"0x91",
+"0xd9",
+"0x8d",
+"0x35",
+"0xb",
+"0x0",
+"0x0",
+"0x2e",
+"0x3",
+"0x0",
+"0x0",
+"0x7d",
+"0xc6",
+"0x0",
+"0x0",
+"0x0",
+"0x0",
+"0xdb",
+"0x25",
+"0xe6",
+"0x68",
+"0x0",
+"0x0",
+"0x0",
+"0x0",
+"0x0",
+"0x0",
+"0x99",
+"0xa7"} 
+,{ 
+"0x45",
+"0x60",
+"0xf1",
+"0x26",
+"0xe3",
+"0x74",
+"0xaf",
+"0xd5",
+"0x0",
+"0x0",
+"0x64",
+"0x1a",
+"0x0",
+"0x0",
+"0x87",
+"0x69",
+"0x0",
+"0x0",
+"0x0",
+"0x0",
+"0xfc",
+"0x7d",
+"0x21",
+"0x85",
+"0x0",
+"0x0",
+"0x0",
+"0x0",
+"0x0",
+"0x0",
+"0xd3",
+"0x99"} 
+}
+};
+static int const kernel2[2][4][3][3] = {
+{{{5,-3,-7},{6,-7,-5},{4,-2,0}},{{3,7,-3},{-2,-7,-3},{-3,2,0}},{{-5,6,-3},{-8,7,5},{1,3,4}},{{0,-4,-8},{6,-6,2},{-7,0,-4}}},
+{{{-1,7,3},{1,3,-4},{1,4,5}},{{-6,-8,-2},{2,-3,-1},{-1,6,4}},{{5,-7,4},{5,-7,-3},{6,-6,0}},{{-3,6,7},{-8,-7,7},{2,1,6}}}
+};
+ } 
+#endif 
@@ -0,0 +1,117 @@
+/******************************************************************************
+ *  Copyright (c) 2026, Advanced Micro Devices, Inc.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *
+ *  1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *
+ *  2.  Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ *  3.  Neither the name of the copyright holder nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION). HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ *  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************/
+/******************************************************************************
+ *
+ *  \file global_accpool_tb.cpp
+ *
+ *  Testbench for the GlobalAccPool_Batch layer with and without requantization
+ *
+ *****************************************************************************/
+
+#include <iostream>
+#include <cmath>
+#include <cstring>
+#include <hls_stream.h>
+#include <cstdlib>
+#define AP_INT_MAX_W 8191
+#include "ap_int.h"
+#include "bnn-library.h"
+using namespace hls;
+using namespace std;
+
+#include "global_accpool_top.h"
+
+#define MAX_IMAGES 4
+
+int main()
+{
+    int SUM[MAX_IMAGES][FM_Channels];
+    stream<ap_uint<PE*INPUT_BITS> > input_stream0("input_stream0");
+    stream<ap_uint<PE*INPUT_BITS> > input_stream1("input_stream1");
+    stream<ap_uint<PE*ACC_BITS> > output_stream0("output_stream0");
+    stream<ap_uint<PE*OUTPUT_BITS> > output_stream1("output_stream1");
+
+    memset(SUM, 0, sizeof(SUM));
+    for (unsigned int n_image = 0; n_image < MAX_IMAGES; n_image++) {
+        for (unsigned int px = 0; px < IFMDim*IFMDim; px++) {
+            for (unsigned int f = 0; f < FOLD; f++) {
+                ap_uint<PE*INPUT_BITS> input_pe = 0;
+                for (unsigned int pe = 0; pe < PE; pe++) {
+                    IN_T input = (IN_T)(rand());
+                    SUM[n_image][f*PE+pe] += input;
+                    input_pe((pe+1)*INPUT_BITS-1, pe*INPUT_BITS) = input;
+                }
+                input_stream0.write(input_pe);
+                input_stream1.write(input_pe);
+            }
+        }
+    }
+
+    Testbench_global_accpool(input_stream0, output_stream0, input_stream1, output_stream1, MAX_IMAGES);
+
+    int err_counter = 0;
+    for (unsigned int n_image = 0; n_image < MAX_IMAGES; n_image++) {
+        for (unsigned int f = 0; f < FOLD; f++) {
+            ap_uint<PE*ACC_BITS> accElem = output_stream0.read();
+            ap_uint<PE*OUTPUT_BITS> outElem = output_stream1.read();
+            for (unsigned int pe = 0; pe < PE; pe++) {
+                unsigned int const channel = f*PE + pe;
+                ACC_T const accumulated = accElem((pe+1)*ACC_BITS-1, pe*ACC_BITS);
+                if (accumulated != SUM[n_image][channel]) {
+                    std::cout << "ERROR: Expected sum[" << n_image << "][" << channel << "]="
+                              << SUM[n_image][channel] << " actual " << accumulated << std::endl;
+                    err_counter++;
+                }
+                // reference: count all passed thresholds
+                unsigned expected = 0;
+                for (unsigned int t = 0; t < NumTH; t++) {
+                    expected += thresholds_init[pe][f][t] < SUM[n_image][channel];
+                }
+                OUT_T const produced = outElem((pe+1)*OUTPUT_BITS-1, pe*OUTPUT_BITS);
+                if (expected != produced) {
+                    std::cout << "ERROR: Expected[" << n_image << "][" << channel << "]="
+                              << expected << " actual " << produced
+                              << " | accumulated value: " << SUM[n_image][channel] << std::endl;
+                    err_counter++;
+                }
+            }
+        }
+    }
+    if (!output_stream0.empty() || !output_stream1.empty()) {
+        std::cout << "ERROR: Unexpected output data" << std::endl;
+        err_counter++;
+    }
+    if (err_counter == 0) {
+        std::cout << "Test passed." << std::endl;
+    }
+    return err_counter;
+}
@@ -0,0 +1,53 @@
+/******************************************************************************
+ *  Copyright (c) 2026, Advanced Micro Devices, Inc.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *
+ *  1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *
+ *  2.  Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ *  3.  Neither the name of the copyright holder nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION). HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ *  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************/
+/******************************************************************************
+ *
+ *  \file global_accpool_top.cpp
+ *
+ *  HLS Top function with GlobalAccPool_Batch layers with and without
+ *  requantization for unit testing
+ *
+ *****************************************************************************/
+
+#include "global_accpool_top.h"
+
+void Testbench_global_accpool(stream<ap_uint<PE*INPUT_BITS> > & in0, stream<ap_uint<PE*ACC_BITS> > & out0,
+                    stream<ap_uint<PE*INPUT_BITS> > & in1, stream<ap_uint<PE*OUTPUT_BITS> > & out1, unsigned int numReps){
+#pragma HLS DATAFLOW
+
+    GlobalAccPool_Batch<IFMDim, FM_Channels, IN_T, PE, ACC_T>(in0, out0, numReps);
+
+    ThresholdsActivation<FOLD, PE, NumTH, ACC_T, OUT_T> threshs = {.m_thresholds = THRESHOLDS_INIT};
+#pragma HLS ARRAY_PARTITION variable=threshs.m_thresholds complete dim=1
+#pragma HLS ARRAY_PARTITION variable=threshs.m_thresholds complete dim=3
+    GlobalAccPool_Batch<IFMDim, FM_Channels, IN_T, PE, ACC_T, OUT_T>(in1, out1, threshs, numReps);
+}
@@ -0,0 +1,74 @@
+/******************************************************************************
+ *  Copyright (c) 2026, Advanced Micro Devices, Inc.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *
+ *  1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *
+ *  2.  Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ *  3.  Neither the name of the copyright holder nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION). HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ *  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************/
+/******************************************************************************
+ *
+ *  \file global_accpool_top.h
+ *
+ *  Configuration of the GlobalAccPool_Batch test
+ *
+ *****************************************************************************/
+#ifndef GLOBAL_ACCPOOL_TOP_H
+#define GLOBAL_ACCPOOL_TOP_H
+
+#include <hls_stream.h>
+using namespace hls;
+#include "ap_int.h"
+#include "bnn-library.h"
+
+#include "activations.hpp"
+#include "interpret.hpp"
+
+#define PE 2
+#define FM_Channels 8
+#define IFMDim 4
+#define NumTH 3
+
+#define INPUT_BITS 4
+#define ACC_BITS 10
+#define OUTPUT_BITS 2
+
+#define IN_T ap_int<INPUT_BITS>
+#define ACC_T ap_int<ACC_BITS>
+#define OUT_T ap_uint<OUTPUT_BITS>
+
+#define FOLD (FM_Channels/PE)
+
+// requantization thresholds sorted in ascending order per channel
+#define THRESHOLDS_INIT {{{-24, -4, 16}, {-20, 0, 20}, {-16, 4, 24}, {-12, 8, 28}}, \
+  {{-22, -2, 18}, {-18, 2, 22}, {-14, 6, 26}, {-10, 10, 30}}}
+
+const int thresholds_init[PE][FOLD][NumTH] = THRESHOLDS_INIT;
+
+void Testbench_global_accpool(stream<ap_uint<PE*INPUT_BITS> > & in0, stream<ap_uint<PE*ACC_BITS> > & out0,
+                    stream<ap_uint<PE*INPUT_BITS> > & in1, stream<ap_uint<PE*OUTPUT_BITS> > & out1, unsigned int numReps);
+
+#endif
@@ -38,6 +38,8 @@
  *  HLS Top function with a single HLS sliding-window generator block unit testing
  *
  *****************************************************************************/
+#define FINN_HLSLIB_COUNT_ITERATIONS 1
+
 #include <hls_stream.h>
 using namespace hls;
 #include "ap_int.h"
@@ -0,0 +1,59 @@
+/******************************************************************************
+ *  Copyright (c) 2026, Advanced Micro Devices, Inc.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *
+ *  1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *
+ *  2.  Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ *  3.  Neither the name of the copyright holder nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION). HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ *  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************/
+/******************************************************************************
+ *
+ *  \file input_gen_3d.cpp
+ *
+ *  HLS Top function with 3D (spatio-temporal) sliding-window generator blocks
+ *  for unit testing
+ *
+ *****************************************************************************/
+#define FINN_HLSLIB_COUNT_ITERATIONS 1
+
+#include <hls_stream.h>
+using namespace hls;
+#include "ap_int.h"
+#include "bnn-library.h"
+#include "data/input_gen_3d.h"
+
+void Testbench_3d(stream<ap_uint<SIMD*INPUT_PRECISION> > & in0, stream<ap_uint<SIMD*INPUT_PRECISION> > & out0,
+                  stream<ap_uint<SIMD*INPUT_PRECISION> > & in1, stream<ap_uint<SIMD*INPUT_PRECISION> > & out1,
+                  stream<ap_uint<SIMD*INPUT_PRECISION> > & in2, stream<ap_uint<SIMD*INPUT_PRECISION> > & out2,
+                  unsigned int numReps)
+{
+ConvolutionInputGenerator_3D<KERNEL_DIM_T0, KERNEL_DIM0, IFM_Channels, INPUT_PRECISION, IFMDepth, IFMDim, OFMDepth0, OFMDim0,
+	SIMD, STRIDE_T0, STRIDE0, DILATION_T0, DILATION0, false>(in0, out0, numReps, ap_resource_dflt());
+ConvolutionInputGenerator_3D<KERNEL_DIM_T1, KERNEL_DIM1, IFM_Channels, INPUT_PRECISION, IFMDepth, IFMDim, OFMDepth1, OFMDim1,
+	SIMD, STRIDE_T1, STRIDE1, DILATION_T1, DILATION1, true>(in1, out1, numReps, ap_resource_dflt());
+ConvolutionInputGenerator_3D<KERNEL_DIM_T2, KERNEL_DIM2, IFM_Channels, INPUT_PRECISION, IFMDepth, IFMDim, OFMDepth2, OFMDim2,
+	SIMD, STRIDE_T2, STRIDE2, DILATION_T2, DILATION2, false>(in2, out2, numReps, ap_resource_dflt());
+}
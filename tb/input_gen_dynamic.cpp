@@ -0,0 +1,64 @@
+/******************************************************************************
+ *  Copyright (c) 2026, Advanced Micro Devices, Inc.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *
+ *  1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *
+ *  2.  Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ *  3.  Neither the name of the copyright holder nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION). HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ *  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************/
+/******************************************************************************
+ *
+ *  \file input_gen_dynamic.cpp
+ *
+ *  HLS Top function with a single runtime-configurable HLS sliding-window generator
+ *  block unit testing
+ *
+ *****************************************************************************/
+#define FINN_HLSLIB_COUNT_ITERATIONS 1
+
+#include <hls_stream.h>
+using namespace hls;
+#include "ap_int.h"
+#include "bnn-library.h"
+#include "data/input_gen_dynamic.h"
+
+void Testbench_dynamic(stream<ap_uint<SIMD*INPUT_PRECISION> > & in, stream<ap_uint<SIMD*INPUT_PRECISION> > & out,
+                       unsigned int kernel_dim, unsigned int ifm_channels, unsigned int ifm_dim, unsigned int ofm_dim,
+                       unsigned int stride, unsigned int numReps)
+{
+#pragma HLS INTERFACE s_axilite port=kernel_dim
+#pragma HLS INTERFACE s_axilite port=ifm_channels
+#pragma HLS INTERFACE s_axilite port=ifm_dim
+#pragma HLS INTERFACE s_axilite port=ofm_dim
+#pragma HLS INTERFACE s_axilite port=stride
+#pragma HLS INTERFACE s_axilite port=numReps
+ConvolutionInputGenerator_dynamic<MAX_KERNEL_DIM,
+	MAX_IFM_Channels,
+	INPUT_PRECISION,
+	MAX_IFMDim,
+	SIMD,
+	MAX_STRIDE>(in, out, kernel_dim, ifm_channels, ifm_dim, ofm_dim, stride, numReps, ap_resource_dflt());
+}
@@ -0,0 +1,62 @@
+/******************************************************************************
+ *  Copyright (c) 2026, Advanced Micro Devices, Inc.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *
+ *  1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *
+ *  2.  Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ *  3.  Neither the name of the copyright holder nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION). HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ *  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************/
+/******************************************************************************
+ *
+ *  \file input_gen_generic.cpp
+ *
+ *  HLS Top function with sliding-window generator blocks supporting any kernel,
+ *  stride and dilation combination for unit testing
+ *
+ *****************************************************************************/
+#define FINN_HLSLIB_COUNT_ITERATIONS 1
+
+#include <hls_stream.h>
+using namespace hls;
+#include "ap_int.h"
+#include "bnn-library.h"
+#include "data/input_gen_generic.h"
+
+void Testbench_generic(stream<ap_uint<SIMD*INPUT_PRECISION> > & in0, stream<ap_uint<SIMD*INPUT_PRECISION> > & out0,
+                       stream<ap_uint<SIMD*INPUT_PRECISION> > & in1, stream<ap_uint<SIMD*INPUT_PRECISION> > & out1,
+                       stream<ap_uint<SIMD*INPUT_PRECISION> > & in2, stream<ap_uint<SIMD*INPUT_PRECISION> > & out2,
+                       stream<ap_uint<SIMD*INPUT_PRECISION> > & in3, stream<MultiChanData<MMV3, SIMD*INPUT_PRECISION> > & out3,
+                       unsigned int numReps)
+{
+ConvolutionInputGenerator_generic<KERNEL_DIM0, IFM_Channels, INPUT_PRECISION, IFMDim, OFMDim0,
+	SIMD, STRIDE0, DILATION0, 1, false>(in0, out0, numReps, ap_resource_dflt());
+ConvolutionInputGenerator_generic<KERNEL_DIM1, IFM_Channels, INPUT_PRECISION, IFMDim, OFMDim1,
+	SIMD, STRIDE1, DILATION1, 1, true>(in1, out1, numReps, ap_resource_dflt());
+ConvolutionInputGenerator_generic<KERNEL_DIM2, IFM_Channels, INPUT_PRECISION, IFMDim, OFMDim2,
+	SIMD, STRIDE2, DILATION2, 1, false>(in2, out2, numReps, ap_resource_dflt());
+ConvolutionInputGenerator_generic<KERNEL_DIM3, IFM_Channels, INPUT_PRECISION, IFMDim, OFMDim3,
+	SIMD, STRIDE3, DILATION3, MMV3, true>(in3, out3, numReps, ap_resource_dflt());
+}
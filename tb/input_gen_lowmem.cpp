@@ -0,0 +1,68 @@
+/******************************************************************************
+ *  Copyright (c) 2026, Advanced Micro Devices, Inc.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *
+ *  1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *
+ *  2.  Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ *  3.  Neither the name of the copyright holder nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION). HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ *  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************/
+/******************************************************************************
+ *
+ *  \file input_gen_lowmem.cpp
+ *
+ *  HLS Top function with sliding-window generator blocks using a reduced
+ *  circular line buffer for unit testing
+ *
+ *****************************************************************************/
+#define FINN_HLSLIB_COUNT_ITERATIONS 1
+
+#include <hls_stream.h>
+using namespace hls;
+#include "ap_int.h"
+#include "bnn-library.h"
+#include "data/input_gen_lowmem.h"
+
+void Testbench_lowmem(stream<ap_uint<SIMD*INPUT_PRECISION> > & in0, stream<ap_uint<SIMD*INPUT_PRECISION> > & out0,
+                      stream<ap_uint<SIMD*INPUT_PRECISION> > & in1, stream<ap_uint<SIMD*INPUT_PRECISION> > & out1,
+                      stream<ap_uint<SIMD*INPUT_PRECISION> > & in2, stream<ap_uint<SIMD*INPUT_PRECISION> > & out2,
+                      stream<ap_uint<SIMD*INPUT_PRECISION> > & in3, stream<ap_uint<SIMD*INPUT_PRECISION> > & out3,
+                      stream<ap_uint<SIMD*INPUT_PRECISION> > & in4, stream<ap_uint<SIMD*INPUT_PRECISION> > & out4,
+                      stream<ap_uint<SIMD*INPUT_PRECISION> > & in5, stream<ap_uint<SIMD*INPUT_PRECISION> > & out5,
+                      unsigned int numReps)
+{
+ConvolutionInputGenerator_lowmem<KERNEL_DIM0, IFM_Channels, INPUT_PRECISION, IFMDim, OFMDim0,
+	SIMD, STRIDE0>(in0, out0, numReps, ap_resource_dflt());
+ConvolutionInputGenerator_lowmem<KERNEL_DIM1, IFM_Channels, INPUT_PRECISION, IFMDim, OFMDim1,
+	SIMD, STRIDE1>(in1, out1, numReps, ap_resource_dflt());
+ConvolutionInputGenerator_lowmem<KERNEL_DIM2, IFM_Channels, INPUT_PRECISION, IFMDim, OFMDim2,
+	SIMD, STRIDE2>(in2, out2, numReps, ap_resource_dflt());
+ConvolutionInputGenerator_lowmem<KERNEL_DIM3, IFM_Channels, INPUT_PRECISION, IFMDim, OFMDim3,
+	SIMD, STRIDE3>(in3, out3, numReps, ap_resource_dflt());
+ConvolutionInputGenerator_lowmem<KERNEL_DIM4, IFM_Channels, INPUT_PRECISION, IFMDim_T, OFMDim4,
+	SIMD, STRIDE4>(in4, out4, numReps, ap_resource_dflt());
+ConvolutionInputGenerator_lowmem<KERNEL_DIM5, IFM_Channels, INPUT_PRECISION, IFMDim_T, OFMDim5,
+	SIMD, STRIDE5, PACKED5>(in5, out5, numReps, ap_resource_dflt());
+}
@@ -0,0 +1,60 @@
+/******************************************************************************
+ *  Copyright (c) 2026, Advanced Micro Devices, Inc.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *
+ *  1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *
+ *  2.  Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ *  3.  Neither the name of the copyright holder nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION). HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ *  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************/
+/******************************************************************************
+ *
+ *  \file input_gen_nonsquare_mmv.cpp
+ *
+ *  HLS Top function with non-square and dilated sliding-window generator blocks
+ *  with MMV support for unit testing
+ *
+ *****************************************************************************/
+#include <hls_stream.h>
+using namespace hls;
+#include "ap_int.h"
+#include "bnn-library.h"
+#include "data/input_gen_nonsquare_mmv.h"
+
+void Testbench_nonsquare_mmv(stream<ap_uint<SIMD*INPUT_PRECISION> > & in0, stream<MultiChanData<MMV0, SIMD*INPUT_PRECISION> > & out0,
+                             stream<ap_uint<SIMD*INPUT_PRECISION> > & in1, stream<MultiChanData<MMV1, SIMD*INPUT_PRECISION> > & out1,
+                             stream<ap_uint<SIMD*INPUT_PRECISION> > & in2, stream<MultiChanData<MMV2, SIMD*INPUT_PRECISION> > & out2,
+                             stream<ap_uint<SIMD*INPUT_PRECISION> > & in3, stream<MultiChanData<MMV3, SIMD*INPUT_PRECISION> > & out3,
+                             unsigned int numReps)
+{
+ConvolutionInputGenerator_NonSquare_MMV<KERNEL_DIM_X0, KERNEL_DIM_Y0, IFM_Channels, INPUT_PRECISION, IFMDim_X0, IFMDim_Y0,
+	OFMDim_X0, OFMDim_Y0, SIMD, STRIDE_X0, STRIDE_Y0, MMV0>(in0, out0, numReps, ap_resource_dflt());
+ConvolutionInputGenerator_NonSquare_MMV<KERNEL_DIM_X1, KERNEL_DIM_Y1, IFM_Channels, INPUT_PRECISION, IFMDim_X1, IFMDim_Y1,
+	OFMDim_X1, OFMDim_Y1, SIMD, STRIDE_X1, STRIDE_Y1, MMV1>(in1, out1, numReps, ap_resource_dflt());
+ConvolutionInputGenerator_NonSquare_dws_MMV<KERNEL_DIM_X2, KERNEL_DIM_Y2, IFM_Channels, INPUT_PRECISION, IFMDim_X2, IFMDim_Y2,
+	OFMDim_X2, OFMDim_Y2, SIMD, STRIDE_X2, STRIDE_Y2, MMV2>(in2, out2, numReps, ap_resource_dflt());
+ConvolutionInputGenerator_NonSquare_Dilated_MMV<KERNEL_DIM_X3, KERNEL_DIM_Y3, IFM_Channels, INPUT_PRECISION, IFMDim_X3, IFMDim_Y3,
+	OFMDim_X3, OFMDim_Y3, SIMD, STRIDE_X3, STRIDE_Y3, DILATION_X3, 1, MMV3>(in3, out3, numReps, ap_resource_dflt());
+}
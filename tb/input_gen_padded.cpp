@@ -0,0 +1,57 @@
+/******************************************************************************
+ *  Copyright (c) 2026, Advanced Micro Devices, Inc.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *
+ *  1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *
+ *  2.  Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ *  3.  Neither the name of the copyright holder nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION). HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ *  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************/
+/******************************************************************************
+ *
+ *  \file input_gen_padded.cpp
+ *
+ *  HLS Top function with sliding-window generator blocks with fused padding
+ *  for unit testing
+ *
+ *****************************************************************************/
+#include <hls_stream.h>
+using namespace hls;
+#include "ap_int.h"
+#include "bnn-library.h"
+#include "data/input_gen_padded.h"
+
+void Testbench_padded(stream<ap_uint<SIMD*INPUT_PRECISION> > & in_zero, stream<ap_uint<SIMD*INPUT_PRECISION> > & out_zero,
+                      stream<ap_uint<SIMD*INPUT_PRECISION> > & in_const, stream<ap_uint<SIMD*INPUT_PRECISION> > & out_const,
+                      stream<ap_uint<SIMD*INPUT_PRECISION> > & in_replicate, stream<ap_uint<SIMD*INPUT_PRECISION> > & out_replicate,
+                      unsigned int numReps)
+{
+ConvolutionInputGenerator_padded<KERNEL_DIM0, IFM_Channels, INPUT_PRECISION, IFMDim, OFMDim0, SIMD,
+	STRIDE0, PAD_BEFORE0, PAD_BEHIND0>(in_zero, out_zero, numReps, ap_padding_zero(), ap_resource_dflt());
+ConvolutionInputGenerator_padded<KERNEL_DIM1, IFM_Channels, INPUT_PRECISION, IFMDim, OFMDim1, SIMD,
+	STRIDE1, PAD_BEFORE1, PAD_BEHIND1>(in_const, out_const, numReps, ap_padding_const<PAD_VALUE>(), ap_resource_dflt());
+ConvolutionInputGenerator_padded<KERNEL_DIM2, IFM_Channels, INPUT_PRECISION, IFMDim, OFMDim2, SIMD,
+	STRIDE2, PAD_BEFORE2, PAD_BEHIND2>(in_replicate, out_replicate, numReps, ap_padding_replicate(), ap_resource_dflt());
+}
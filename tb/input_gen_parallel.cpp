@@ -0,0 +1,54 @@
+/******************************************************************************
+ *  Copyright (c) 2026, Advanced Micro Devices, Inc.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *
+ *  1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *
+ *  2.  Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ *  3.  Neither the name of the copyright holder nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION). HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ *  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************/
+/******************************************************************************
+ *
+ *  \file input_gen_parallel.cpp
+ *
+ *  HLS Top function with sliding-window generator blocks producing a full window
+ *  per cycle for unit testing
+ *
+ *****************************************************************************/
+#include <hls_stream.h>
+using namespace hls;
+#include "ap_int.h"
+#include "bnn-library.h"
+#include "data/input_gen_parallel.h"
+
+void Testbench_parallel(stream<ap_uint<SIMD*INPUT_PRECISION> > & in0, stream<ap_uint<KERNEL_DIM0*KERNEL_DIM0*SIMD*INPUT_PRECISION> > & out0,
+                        stream<ap_uint<SIMD*INPUT_PRECISION> > & in1, stream<ap_uint<KERNEL_DIM1*KERNEL_DIM1*SIMD*INPUT_PRECISION> > & out1,
+                        unsigned int numReps)
+{
+ConvolutionInputGenerator_parallel<KERNEL_DIM0, IFM_Channels, INPUT_PRECISION, IFMDim, OFMDim0,
+	STRIDE0, SIMD>(in0, out0, numReps, ap_resource_dflt());
+ConvolutionInputGenerator_parallel<KERNEL_DIM1, IFM_Channels, INPUT_PRECISION, IFMDim, OFMDim1,
+	STRIDE1, SIMD>(in1, out1, numReps, ap_resource_dflt());
+}
@@ -0,0 +1,122 @@
+/******************************************************************************
+ *  Copyright (c) 2026, Advanced Micro Devices, Inc.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *
+ *  1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *
+ *  2.  Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ *  3.  Neither the name of the copyright holder nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION). HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ *  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************/
+/******************************************************************************
+ *
+ *  \file label_select_tree_tb.cpp
+ *
+ *  Testbench for the LabelSelect_Tree_Batch layer
+ *
+ *****************************************************************************/
+
+#include <iostream>
+#include <algorithm>
+#include <cstring>
+#include <hls_stream.h>
+#include <cstdlib>
+#define AP_INT_MAX_W 8191
+#include "ap_int.h"
+#include "bnn-library.h"
+using namespace hls;
+using namespace std;
+
+#include "label_select_tree_top.h"
+
+#define MAX_IMAGES 4
+
+// feeds random scores to the layer and checks its output against a stable sort of the labels
+template<unsigned int NumClasses, unsigned int PE, unsigned int NumTop, typename In_T, typename Out_T>
+class TopChecker {
+    In_T scores[MAX_IMAGES][NumClasses];
+public:
+    void fill(stream<ap_uint<PE*In_T::width> > & in) {
+        for (unsigned int n_image = 0; n_image < MAX_IMAGES; n_image++)
+            for (unsigned int block = 0; block < NumClasses/PE; block++) {
+                ap_uint<PE*In_T::width> input_pe = 0;
+                for (unsigned int pe = 0; pe < PE; pe++) {
+                    In_T const input = (In_T)(rand());
+                    scores[n_image][block*PE+pe] = input;
+                    input_pe((pe+1)*In_T::width-1, pe*In_T::width) = input;
+                }
+                in.write(input_pe);
+            }
+    }
+    int check(stream<Out_T> & out) {
+        int err_counter = 0;
+        for (unsigned int n_image = 0; n_image < MAX_IMAGES; n_image++) {
+            // equal scores are ranked by ascending label
+            unsigned int labels[NumClasses];
+            for (unsigned int i = 0; i < NumClasses; i++)
+                labels[i] = i;
+            In_T const *const image = scores[n_image];
+            std::stable_sort(labels, labels + NumClasses,
+                [image](unsigned int a, unsigned int b) { return image[a] > image[b]; });
+            for (unsigned int i = 0; i < NumTop; i++) {
+                if (out.empty()) {
+                    std::cout << "ERROR: Missing output data" << std::endl;
+                    return err_counter + 1;
+                }
+                Out_T const outElem = out.read();
+                if (outElem != labels[i]) {
+                    std::cout << "ERROR: Image " << n_image << " top " << i+1 << " was expected to be "
+                              << labels[i] << " but got " << outElem << std::endl;
+                    err_counter++;
+                }
+            }
+        }
+        if (!out.empty()) {
+            std::cout << "ERROR: Unexpected output data" << std::endl;
+            err_counter++;
+        }
+        return err_counter;
+    }
+};
+
+int main()
+{
+    static TopChecker<NumClasses0, PE0, NumTop0, In_T0, Out_T0> checker0;
+    static TopChecker<NumClasses1, PE1, NumTop1, In_T1, Out_T1> checker1;
+    stream<ap_uint<PE0*In_T0::width> > input_stream0("input_stream0");
+    stream<Out_T0> output_stream0("output_stream0");
+    stream<ap_uint<PE1*In_T1::width> > input_stream1("input_stream1");
+    stream<Out_T1> output_stream1("output_stream1");
+
+    checker0.fill(input_stream0);
+    checker1.fill(input_stream1);
+
+    Testbench_label_select_tree(input_stream0, output_stream0, input_stream1, output_stream1, MAX_IMAGES);
+
+    int err_counter = checker0.check(output_stream0) + checker1.check(output_stream1);
+    if (err_counter == 0) {
+        std::cout << "Test passed." << std::endl;
+    }
+    return err_counter;
+}
@@ -0,0 +1,148 @@
+/******************************************************************************
+ *  Copyright (c) 2026, Advanced Micro Devices, Inc.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *
+ *  1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *
+ *  2.  Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ *  3.  Neither the name of the copyright holder nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION). HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ *  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************/
+/******************************************************************************
+ *
+ *  \file mac_accumulator_tb.cpp
+ *
+ *  Testbench for the accumulator width inference: compile-time checks of
+ *  MacAccumulator and mac_accumulator_fits, and an MVAU accumulating the
+ *  extreme products into the inferred type
+ *
+ *****************************************************************************/
+#include <iostream>
+#include <cmath>
+#include <ctime>
+#include <cstring>
+#include <hls_stream.h>
+#include <cstdlib>
+#define AP_INT_MAX_W 8191
+#include "ap_int.h"
+#include "bnn-library.h"
+
+#include "mac_accumulator_top.h"
+
+using namespace hls;
+using namespace std;
+
+#define MAX_IMAGES 4
+
+// 24 products in [-8*7, 7*7] sum up to [-1344, 1176], i.e. 12 bits signed
+static_assert(MacAccumulator<MatrixW1, WEIGHT_T, INPUT_T>::min == -1344, "");
+static_assert(MacAccumulator<MatrixW1, WEIGHT_T, INPUT_T>::max == 1176, "");
+static_assert(std::is_same<ACC_T, ap_int<12>>::value, "");
+// unsigned operands yield an unsigned accumulator, [0, 24*7*7] needs 11 bits
+static_assert(std::is_same<MacAccumulator<MatrixW1, ap_uint<3>, ap_uint<3>>::type, ap_uint<11>>::value, "");
+// a sum of 24 XNOR products is in [0, 24]
+static_assert(std::is_same<MacAccumulator<MatrixW1, XnorMul, ap_uint<1>>::type, ap_uint<5>>::value, "");
+static_assert(std::is_same<MacAccumulator<MatrixW1, Binary, Binary>::type, ap_int<6>>::value, "");
+
+// the inferred type fits, one bit less does not
+static_assert(mac_accumulator_fits<ap_int<12>, MatrixW1, WEIGHT_T, INPUT_T>(), "");
+static_assert(!mac_accumulator_fits<ap_int<11>, MatrixW1, WEIGHT_T, INPUT_T>(), "");
+static_assert(mac_accumulator_fits<ap_uint<11>, MatrixW1, ap_uint<3>, ap_uint<3>>(), "");
+static_assert(!mac_accumulator_fits<ap_uint<10>, MatrixW1, ap_uint<3>, ap_uint<3>>(), "");
+// the signedness counts: an unsigned accumulator cannot hold negative sums and
+// a signed one of the same width only holds half of the unsigned range
+static_assert(!mac_accumulator_fits<ap_uint<16>, MatrixW1, WEIGHT_T, INPUT_T>(), "");
+static_assert(!mac_accumulator_fits<ap_int<11>, MatrixW1, ap_uint<3>, ap_uint<3>>(), "");
+static_assert(mac_accumulator_fits<ap_int<12>, MatrixW1, ap_uint<3>, ap_uint<3>>(), "");
+// the default activation of the MVAU and VVAU accumulates into the inferred type
+static_assert(std::is_same<decltype(MacPassThroughActivation<MatrixW1, WEIGHT_T, INPUT_T>().init(0, 0)), ACC_T>::value, "");
+// operands or accumulators of unknown range pass
+static_assert(mac_accumulator_fits<ap_int<2>, MatrixW1, ap_int<32>, INPUT_T>(), "");
+static_assert(mac_accumulator_fits<int, MatrixW1, WEIGHT_T, INPUT_T>(), "");
+
+int main()
+{
+	constexpr unsigned NF = MatrixH1 / PE1;
+	constexpr unsigned SF = MatrixW1 / SIMD1;
+	static WEIGHT_T W[MAX_IMAGES][MatrixH1][MatrixW1];
+	static INPUT_T IMAGE[MAX_IMAGES][MatrixW1];
+	static int TEST[MAX_IMAGES][MatrixH1];
+	stream<ap_uint<SIMD1*INPUT_PRECISION> > input_stream("input_stream");
+	stream<ap_uint<PE1*SIMD1*WEIGHT_PRECISION> > weight_stream("weight_stream");
+	stream<ap_uint<PE1*ACC_BITS> > output_stream("output_stream");
+
+	// image 0 reaches the minimum sum, image 1 the maximum one, the others are random
+	for(unsigned n = 0; n < MAX_IMAGES; n++) {
+		for(unsigned w = 0; w < MatrixW1; w++) {
+			IMAGE[n][w] = n < 2? INPUT_T(-1) : INPUT_T(rand());
+			for(unsigned h = 0; h < MatrixH1; h++)
+				W[n][h][w] = n == 0? WEIGHT_T(-8) : n == 1? WEIGHT_T(7) : WEIGHT_T(rand());
+		}
+	}
+
+	for(unsigned n = 0; n < MAX_IMAGES; n++) {
+		for(unsigned sf = 0; sf < SF; sf++) {
+			ap_uint<SIMD1*INPUT_PRECISION> inElem;
+			for(unsigned simd = 0; simd < SIMD1; simd++)
+				inElem((simd+1)*INPUT_PRECISION-1, simd*INPUT_PRECISION) = IMAGE[n][sf*SIMD1+simd];
+			input_stream.write(inElem);
+		}
+		for(unsigned nf = 0; nf < NF; nf++) {
+			for(unsigned sf = 0; sf < SF; sf++) {
+				ap_uint<PE1*SIMD1*WEIGHT_PRECISION> wElem;
+				for(unsigned pe = 0; pe < PE1; pe++)
+					for(unsigned simd = 0; simd < SIMD1; simd++)
+						wElem((pe*SIMD1+simd+1)*WEIGHT_PRECISION-1, (pe*SIMD1+simd)*WEIGHT_PRECISION) = W[n][nf*PE1+pe][sf*SIMD1+simd];
+				weight_stream.write(wElem);
+			}
+		}
+		for(unsigned h = 0; h < MatrixH1; h++) {
+			int acc = 0;
+			for(unsigned w = 0; w < MatrixW1; w++)
+				acc += W[n][h][w] * IMAGE[n][w];
+			TEST[n][h] = acc;
+		}
+	}
+
+	Testbench_mac_accumulator(input_stream, weight_stream, output_stream, MAX_IMAGES);
+
+	int err_counter = 0;
+	for(unsigned n = 0; n < MAX_IMAGES; n++) {
+		for(unsigned nf = 0; nf < NF; nf++) {
+			ap_uint<PE1*ACC_BITS> outElem = output_stream.read();
+			for(unsigned pe = 0; pe < PE1; pe++) {
+				ACC_T const  out_chan = outElem((pe+1)*ACC_BITS-1, pe*ACC_BITS);
+				int const  EXP = TEST[n][nf*PE1+pe];
+				if(EXP != out_chan) {
+					std::cout << "ERROR: Expected[" << n << "][" << nf*PE1+pe << "]=" << EXP << " actual " << out_chan << std::endl;
+					err_counter++;
+				}
+			}
+		}
+	}
+	if(err_counter == 0) {
+		std::cout << "Test passed." << std::endl;
+	}
+	return err_counter;
+}
@@ -0,0 +1,54 @@
+/******************************************************************************
+ *  Copyright (c) 2026, Advanced Micro Devices, Inc.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *
+ *  1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *
+ *  2.  Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ *  3.  Neither the name of the copyright holder nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION). HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ *  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************/
+/******************************************************************************
+ *
+ *  \file mac_accumulator_top.cpp
+ *
+ *  HLS Top function with a single MVAU without activation, accumulating into
+ *  the MacAccumulator type, with the accumulator check enabled for unit testing
+ *
+ *****************************************************************************/
+#define FINN_HLSLIB_CHECK_ACCU_WIDTH 1
+
+#include "mac_accumulator_top.h"
+#include "activations.hpp"
+#include "interpret.hpp"
+#include "mvau.hpp"
+
+void Testbench_mac_accumulator(stream<ap_uint<SIMD1*INPUT_PRECISION> > & in,
+                stream<ap_uint<PE1*SIMD1*WEIGHT_PRECISION> > & weights,
+                stream<ap_uint<PE1*ACC_BITS> > & out, unsigned int numReps){
+#pragma HLS DATAFLOW
+    // no activation: accumulates into MacAccumulator<MatrixW1, WEIGHT_T, INPUT_T>::type
+    Matrix_Vector_Activate_Stream_Batch<MatrixW1, MatrixH1, SIMD1, PE1, Slice<INPUT_T>, Slice<ACC_T>, Identity, WEIGHT_T>
+        (in, out, weights, numReps, ap_resource_dflt());
+}
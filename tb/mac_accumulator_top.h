@@ -0,0 +1,64 @@
+/******************************************************************************
+ *  Copyright (c) 2026, Advanced Micro Devices, Inc.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *
+ *  1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *
+ *  2.  Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ *  3.  Neither the name of the copyright holder nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION). HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ *  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************/
+/******************************************************************************
+ *
+ *  \file mac_accumulator_top.h
+ *
+ *  Configuration of the MVAU test with an accumulator of the width inferred
+ *  by MacAccumulator
+ *
+ *****************************************************************************/
+#ifndef MAC_ACCUMULATOR_TOP_H
+#define MAC_ACCUMULATOR_TOP_H
+
+#include <hls_stream.h>
+using namespace hls;
+#include "ap_int.h"
+#include "bnn-library.h"
+
+#define MatrixW1 24
+#define MatrixH1 8
+#define SIMD1 4
+#define PE1 2
+#define WEIGHT_PRECISION 4
+#define INPUT_PRECISION 3
+
+#define WEIGHT_T ap_int<WEIGHT_PRECISION>
+#define INPUT_T ap_uint<INPUT_PRECISION>
+typedef MacAccumulator<MatrixW1, WEIGHT_T, INPUT_T>::type  ACC_T;
+#define ACC_BITS ACC_T::width
+
+void Testbench_mac_accumulator(stream<ap_uint<SIMD1*INPUT_PRECISION> > & in,
+                stream<ap_uint<PE1*SIMD1*WEIGHT_PRECISION> > & weights,
+                stream<ap_uint<PE1*ACC_BITS> > & out, unsigned int numReps);
+
+#endif
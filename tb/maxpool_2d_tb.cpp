@@ -0,0 +1,138 @@
+/******************************************************************************
+ *  Copyright (c) 2026, Advanced Micro Devices, Inc.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *
+ *  1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *
+ *  2.  Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ *  3.  Neither the name of the copyright holder nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION). HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ *  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************/
+/******************************************************************************
+ *
+ *  \file maxpool_2d_tb.cpp
+ *
+ *  Testbench for the 2d maxpool layer HLS block with any kernel and stride
+ *
+ *****************************************************************************/
+
+#include <iostream>
+#include <cmath>
+#include <cstring>
+#include <hls_stream.h>
+#include <cstdlib>
+#define AP_INT_MAX_W 8191
+#include "ap_int.h"
+#include "bnn-library.h"
+using namespace hls;
+using namespace std;
+
+#include "maxpool_2d_top.h"
+
+#define MAX_IMAGES 2
+
+// feeds random images to the layer and checks its output against a direct window maximum
+template<unsigned int ImgDimX, unsigned int ImgDimY, unsigned int PoolDimX, unsigned int PoolDimY,
+        unsigned int StrideX, unsigned int StrideY, unsigned int OFMDimX, unsigned int OFMDimY,
+        unsigned int NumChannels, unsigned int PE, typename ActType>
+class PoolChecker {
+    static constexpr unsigned int NF = NumChannels / PE;
+    ActType image[MAX_IMAGES][ImgDimY][ImgDimX][NumChannels];
+public:
+    void fill(stream<ap_uint<PE*ActType::width> > & in) {
+        for (unsigned int n_image = 0; n_image < MAX_IMAGES; n_image++)
+            for (unsigned int y = 0; y < ImgDimY; y++)
+                for (unsigned int x = 0; x < ImgDimX; x++)
+                    for (unsigned int f = 0; f < NF; f++) {
+                        ap_uint<PE*ActType::width> input_pe = 0;
+                        for (unsigned int p = 0; p < PE; p++) {
+                            ActType const input = (ActType)(rand());
+                            image[n_image][y][x][f*PE+p] = input;
+                            input_pe((p+1)*ActType::width-1, p*ActType::width) = input;
+                        }
+                        in.write(input_pe);
+                    }
+    }
+    int check(stream<ap_uint<PE*ActType::width> > & out) {
+        int err_counter = 0;
+        for (unsigned int n_image = 0; n_image < MAX_IMAGES; n_image++)
+            for (unsigned int oy = 0; oy < OFMDimY; oy++)
+                for (unsigned int ox = 0; ox < OFMDimX; ox++)
+                    for (unsigned int f = 0; f < NF; f++) {
+                        if (out.empty()) {
+                            std::cout << "ERROR: Missing output data" << std::endl;
+                            return err_counter + 1;
+                        }
+                        ap_uint<PE*ActType::width> const outElem = out.read();
+                        for (unsigned int p = 0; p < PE; p++) {
+                            unsigned int const channel = f*PE + p;
+                            ActType expected = image[n_image][oy*StrideY][ox*StrideX][channel];
+                            for (unsigned int ky = 0; ky < PoolDimY; ky++)
+                                for (unsigned int kx = 0; kx < PoolDimX; kx++) {
+                                    ActType const val = image[n_image][oy*StrideY+ky][ox*StrideX+kx][channel];
+                                    if (val > expected)
+                                        expected = val;
+                                }
+                            ActType const produced = outElem((p+1)*ActType::width-1, p*ActType::width);
+                            if (expected != produced) {
+                                std::cout << "ERROR: Expected[" << n_image << "][" << oy << "][" << ox << "][" << channel
+                                          << "]=" << expected << " actual " << produced << std::endl;
+                                err_counter++;
+                            }
+                        }
+                    }
+        if (!out.empty()) {
+            std::cout << "ERROR: Unexpected output data" << std::endl;
+            err_counter++;
+        }
+        return err_counter;
+    }
+};
+
+int main()
+{
+    static PoolChecker<IFMDimX0, IFMDimY0, KERNEL_X0, KERNEL_Y0, STRIDE_X0, STRIDE_Y0, OFMDimX0, OFMDimY0,
+        FM_Channels0, PE0, ACT_T0> checker0;
+    static PoolChecker<IFMDimX1, IFMDimY1, KERNEL_X1, KERNEL_Y1, STRIDE_X1, STRIDE_Y1, OFMDimX1, OFMDimY1,
+        FM_Channels1, PE1, ACT_T1> checker1;
+    stream<ap_uint<PE0*PRECISION0> > input_stream0("input_stream0");
+    stream<ap_uint<PE0*PRECISION0> > output_stream0("output_stream0");
+    stream<ap_uint<PE1*PRECISION1> > input_stream1("input_stream1");
+    stream<ap_uint<PE1*PRECISION1> > output_stream1("output_stream1");
+
+    checker0.fill(input_stream0);
+    checker1.fill(input_stream1);
+
+    Testbench_pool_2d(input_stream0, output_stream0, input_stream1, output_stream1, MAX_IMAGES);
+
+    int err_counter = checker0.check(output_stream0) + checker1.check(output_stream1);
+    if (!input_stream0.empty() || !input_stream1.empty()) {
+        std::cout << "ERROR: Input data left unread" << std::endl;
+        err_counter++;
+    }
+    if (err_counter == 0) {
+        std::cout << "Test passed." << std::endl;
+    }
+    return err_counter;
+}
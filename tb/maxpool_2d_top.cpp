@@ -0,0 +1,52 @@
+/******************************************************************************
+ *  Copyright (c) 2026, Advanced Micro Devices, Inc.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *
+ *  1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *
+ *  2.  Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ *  3.  Neither the name of the copyright holder nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION). HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ *  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************/
+/******************************************************************************
+ *
+ *  \file maxpool_2d_top.cpp
+ *
+ *  HLS Top function with StreamingMaxPool_Precision_Batch_2d layers with
+ *  overlapping and non-overlapping windows for unit testing
+ *
+ *****************************************************************************/
+
+#include "maxpool_2d_top.h"
+
+void Testbench_pool_2d(stream<ap_uint<PE0*PRECISION0> > & in0, stream<ap_uint<PE0*PRECISION0> > & out0,
+                    stream<ap_uint<PE1*PRECISION1> > & in1, stream<ap_uint<PE1*PRECISION1> > & out1, unsigned int numReps){
+#pragma HLS DATAFLOW
+
+    StreamingMaxPool_Precision_Batch_2d<IFMDimX0, IFMDimY0, KERNEL_X0, KERNEL_Y0, STRIDE_X0, STRIDE_Y0,
+        FM_Channels0, PE0, ACT_T0, MIN_VALUE0>(in0, out0, numReps);
+
+    StreamingMaxPool_Precision_Batch_2d<IFMDimX1, IFMDimY1, KERNEL_X1, KERNEL_Y1, STRIDE_X1, STRIDE_Y1,
+        FM_Channels1, PE1, ACT_T1, MIN_VALUE1>(in1, out1, numReps);
+}
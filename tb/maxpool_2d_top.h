@@ -0,0 +1,80 @@
+/******************************************************************************
+ *  Copyright (c) 2026, Advanced Micro Devices, Inc.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *
+ *  1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *
+ *  2.  Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ *  3.  Neither the name of the copyright holder nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION). HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ *  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************/
+/******************************************************************************
+ *
+ *  \file maxpool_2d_top.h
+ *
+ *  Configuration of the StreamingMaxPool_Precision_2d test
+ *
+ *****************************************************************************/
+#ifndef MAXPOOL_2D_TOP_H
+#define MAXPOOL_2D_TOP_H
+
+#include <hls_stream.h>
+using namespace hls;
+#include "ap_int.h"
+#include "bnn-library.h"
+
+// overlapping 3x3 windows with stride 2 on a non-square image, signed values
+#define FM_Channels0 8
+#define PE0 2
+#define IFMDimX0 11
+#define IFMDimY0 9
+#define KERNEL_X0 3
+#define KERNEL_Y0 3
+#define STRIDE_X0 2
+#define STRIDE_Y0 2
+#define PRECISION0 4
+#define ACT_T0 ap_int<PRECISION0>
+#define MIN_VALUE0 -8
+#define OFMDimX0 ((IFMDimX0 - KERNEL_X0)/STRIDE_X0 + 1)
+#define OFMDimY0 ((IFMDimY0 - KERNEL_Y0)/STRIDE_Y0 + 1)
+
+// non-square kernel with a horizontal stride larger than the kernel, unsigned values
+#define FM_Channels1 4
+#define PE1 4
+#define IFMDimX1 10
+#define IFMDimY1 7
+#define KERNEL_X1 2
+#define KERNEL_Y1 3
+#define STRIDE_X1 3
+#define STRIDE_Y1 1
+#define PRECISION1 5
+#define ACT_T1 ap_uint<PRECISION1>
+#define MIN_VALUE1 0
+#define OFMDimX1 ((IFMDimX1 - KERNEL_X1)/STRIDE_X1 + 1)
+#define OFMDimY1 ((IFMDimY1 - KERNEL_Y1)/STRIDE_Y1 + 1)
+
+void Testbench_pool_2d(stream<ap_uint<PE0*PRECISION0> > & in0, stream<ap_uint<PE0*PRECISION0> > & out0,
+                    stream<ap_uint<PE1*PRECISION1> > & in1, stream<ap_uint<PE1*PRECISION1> > & out1, unsigned int numReps);
+
+#endif
@@ -0,0 +1,119 @@
+/******************************************************************************
+ *  Copyright (c) 2026, Advanced Micro Devices, Inc.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *
+ *  1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *
+ *  2.  Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ *  3.  Neither the name of the copyright holder nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION). HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ *  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************/
+/******************************************************************************
+ *
+ *  \file mvau_dsp_packed_tb.cpp
+ *
+ *  Testbench for the MVAU using packed DSP48 multiplications
+ *
+ *****************************************************************************/
+#include <iostream>
+#include <cmath>
+#include <ctime>
+#include <cstring>
+#include <hls_stream.h>
+#include <cstdlib>
+#define AP_INT_MAX_W 8191
+#include "ap_int.h"
+#include "bnn-library.h"
+
+#include "mvau_dsp_packed_top.h"
+
+using namespace hls;
+using namespace std;
+
+#define MAX_IMAGES 4
+
+int main()
+{
+	constexpr unsigned NF = MatrixH1 / PE1;
+	constexpr unsigned SF = MatrixW1 / SIMD1;
+	static ap_int<WEIGHT_PRECISION> W[MatrixH1][MatrixW1];
+	static ap_int<INPUT_PRECISION> IMAGE[MAX_IMAGES][MatrixW1];
+	static ap_int<ACTIVATION_PRECISION> TEST[MAX_IMAGES][MatrixH1];
+	stream<ap_uint<SIMD1*INPUT_PRECISION> > input_stream("input_stream");
+	stream<ap_uint<PE1*SIMD1*WEIGHT_PRECISION> > weight_stream("weight_stream");
+	stream<ap_uint<PE1*ACTIVATION_PRECISION> > output_stream("output_stream");
+
+	// random weights and inputs covering the full signed range
+	for(unsigned h = 0; h < MatrixH1; h++)
+		for(unsigned w = 0; w < MatrixW1; w++)
+			W[h][w] = ap_int<WEIGHT_PRECISION>(rand());
+	for(unsigned n = 0; n < MAX_IMAGES; n++)
+		for(unsigned w = 0; w < MatrixW1; w++)
+			IMAGE[n][w] = ap_int<INPUT_PRECISION>(rand());
+
+	for(unsigned n = 0; n < MAX_IMAGES; n++) {
+		for(unsigned sf = 0; sf < SF; sf++) {
+			ap_uint<SIMD1*INPUT_PRECISION> inElem;
+			for(unsigned simd = 0; simd < SIMD1; simd++)
+				inElem((simd+1)*INPUT_PRECISION-1, simd*INPUT_PRECISION) = IMAGE[n][sf*SIMD1+simd];
+			input_stream.write(inElem);
+		}
+		for(unsigned nf = 0; nf < NF; nf++) {
+			for(unsigned sf = 0; sf < SF; sf++) {
+				ap_uint<PE1*SIMD1*WEIGHT_PRECISION> wElem;
+				for(unsigned pe = 0; pe < PE1; pe++)
+					for(unsigned simd = 0; simd < SIMD1; simd++)
+						wElem((pe*SIMD1+simd+1)*WEIGHT_PRECISION-1, (pe*SIMD1+simd)*WEIGHT_PRECISION) = W[nf*PE1+pe][sf*SIMD1+simd];
+				weight_stream.write(wElem);
+			}
+		}
+		for(unsigned h = 0; h < MatrixH1; h++) {
+			int acc = 0;
+			for(unsigned w = 0; w < MatrixW1; w++)
+				acc += W[h][w] * IMAGE[n][w];
+			TEST[n][h] = acc;
+		}
+	}
+
+	Testbench_mvau_dsp_packed(input_stream, weight_stream, output_stream, MAX_IMAGES);
+
+	int err_counter = 0;
+	for(unsigned n = 0; n < MAX_IMAGES; n++) {
+		for(unsigned nf = 0; nf < NF; nf++) {
+			ap_uint<PE1*ACTIVATION_PRECISION> outElem = output_stream.read();
+			for(unsigned pe = 0; pe < PE1; pe++) {
+				ap_int<ACTIVATION_PRECISION> const  out_chan = outElem((pe+1)*ACTIVATION_PRECISION-1, pe*ACTIVATION_PRECISION);
+				ap_int<ACTIVATION_PRECISION> const  EXP = TEST[n][nf*PE1+pe];
+				if(EXP != out_chan) {
+					std::cout << "ERROR: Expected[" << n << "][" << nf*PE1+pe << "]=" << EXP << " actual " << out_chan << std::endl;
+					err_counter++;
+				}
+			}
+		}
+	}
+	if(err_counter == 0) {
+		std::cout << "Test passed." << std::endl;
+	}
+	return err_counter;
+}
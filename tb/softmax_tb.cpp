@@ -0,0 +1,134 @@
+/******************************************************************************
+ *  Copyright (c) 2026, Advanced Micro Devices, Inc.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *
+ *  1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *
+ *  2.  Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ *  3.  Neither the name of the copyright holder nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION). HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ *  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************/
+/******************************************************************************
+ *
+ *  \file softmax_tb.cpp
+ *
+ *  Testbench for the Softmax_Batch layer producing probabilities and log-probabilities
+ *
+ *****************************************************************************/
+
+#include <iostream>
+#include <cmath>
+#include <cstring>
+#include <hls_stream.h>
+#include <cstdlib>
+#define AP_INT_MAX_W 8191
+#include "ap_int.h"
+#include "bnn-library.h"
+using namespace hls;
+using namespace std;
+
+#include "softmax_top.h"
+
+#define MAX_IMAGES 2
+// accepted deviation from the floating-point reference, in output LSBs
+#define TOLERANCE 1
+
+// feeds random inputs to the layer and checks its output against a floating-point (log-)softmax
+template<unsigned int ImgDim, unsigned int NumChannels, unsigned int PE, typename In_T, typename Out_T,
+        unsigned int InFrac, unsigned int OutFrac, bool LogSoftmax>
+class SoftmaxChecker {
+    static constexpr unsigned int NF = NumChannels / PE;
+    double inputs[MAX_IMAGES*ImgDim][NumChannels];
+public:
+    void fill(stream<ap_uint<PE*In_T::width> > & in) {
+        for (unsigned int pixel = 0; pixel < MAX_IMAGES*ImgDim; pixel++)
+            for (unsigned int f = 0; f < NF; f++) {
+                ap_uint<PE*In_T::width> input_pe = 0;
+                for (unsigned int pe = 0; pe < PE; pe++) {
+                    In_T const input = (In_T)(rand());
+                    inputs[pixel][f*PE+pe] = ldexp(double(input), -int(InFrac));
+                    input_pe((pe+1)*In_T::width-1, pe*In_T::width) = input;
+                }
+                in.write(input_pe);
+            }
+    }
+    int check(stream<ap_uint<PE*Out_T::width> > & out) {
+        double const out_min = Out_T::sign_flag? -ldexp(1.0, Out_T::width-1) : 0.0;
+        double const out_max = Out_T::sign_flag? ldexp(1.0, Out_T::width-1) - 1 : ldexp(1.0, Out_T::width) - 1;
+        int err_counter = 0;
+        for (unsigned int pixel = 0; pixel < MAX_IMAGES*ImgDim; pixel++) {
+            double max = inputs[pixel][0];
+            for (unsigned int c = 1; c < NumChannels; c++)
+                max = std::max(max, inputs[pixel][c]);
+            double sum = 0;
+            for (unsigned int c = 0; c < NumChannels; c++)
+                sum += exp(inputs[pixel][c] - max);
+            for (unsigned int f = 0; f < NF; f++) {
+                if (out.empty()) {
+                    std::cout << "ERROR: Missing output data" << std::endl;
+                    return err_counter + 1;
+                }
+                ap_uint<PE*Out_T::width> const outElem = out.read();
+                for (unsigned int pe = 0; pe < PE; pe++) {
+                    unsigned int const channel = f*PE + pe;
+                    double const real = LogSoftmax? inputs[pixel][channel] - max - log(sum) :
+                                                    exp(inputs[pixel][channel] - max) / sum;
+                    double const expected = std::min(out_max, std::max(out_min, ldexp(real, OutFrac)));
+                    Out_T const produced = outElem((pe+1)*Out_T::width-1, pe*Out_T::width);
+                    if (fabs(double(produced) - expected) > TOLERANCE) {
+                        std::cout << "ERROR: Expected[" << pixel << "][" << channel << "]=" << expected
+                                  << " actual " << produced << std::endl;
+                        err_counter++;
+                    }
+                }
+            }
+        }
+        if (!out.empty()) {
+            std::cout << "ERROR: Unexpected output data" << std::endl;
+            err_counter++;
+        }
+        return err_counter;
+    }
+};
+
+int main()
+{
+    static SoftmaxChecker<ImgDim0, NumChannels0, PE0, In_T0, Out_T0, InFrac0, OutFrac0, false> checker0;
+    static SoftmaxChecker<ImgDim1, NumChannels1, PE1, In_T1, Out_T1, InFrac1, OutFrac1, true> checker1;
+    stream<ap_uint<PE0*In_T0::width> > input_stream0("input_stream0");
+    stream<ap_uint<PE0*Out_T0::width> > output_stream0("output_stream0");
+    stream<ap_uint<PE1*In_T1::width> > input_stream1("input_stream1");
+    stream<ap_uint<PE1*Out_T1::width> > output_stream1("output_stream1");
+
+    checker0.fill(input_stream0);
+    checker1.fill(input_stream1);
+
+    Testbench_softmax(input_stream0, output_stream0, input_stream1, output_stream1, MAX_IMAGES);
+
+    int err_counter = checker0.check(output_stream0) + checker1.check(output_stream1);
+    if (err_counter == 0) {
+        std::cout << "Test passed." << std::endl;
+    }
+    return err_counter;
+}
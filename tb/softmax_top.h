@@ -0,0 +1,68 @@
+/******************************************************************************
+ *  Copyright (c) 2026, Advanced Micro Devices, Inc.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *
+ *  1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *
+ *  2.  Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ *  3.  Neither the name of the copyright holder nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION). HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ *  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************/
+/******************************************************************************
+ *
+ *  \file softmax_top.h
+ *
+ *  Configuration of the Softmax_Batch test
+ *
+ *****************************************************************************/
+#ifndef SOFTMAX_TOP_H
+#define SOFTMAX_TOP_H
+
+#include <hls_stream.h>
+using namespace hls;
+#include "ap_int.h"
+#include "bnn-library.h"
+
+// probabilities of a classifier head from signed logits
+#define ImgDim0 2
+#define NumChannels0 12
+#define PE0 4
+#define In_T0 ap_int<8>
+#define Out_T0 ap_uint<8>
+#define InFrac0 4
+#define OutFrac0 8
+
+// per-pixel log-probabilities from unsigned inputs
+#define ImgDim1 3
+#define NumChannels1 16
+#define PE1 2
+#define In_T1 ap_uint<6>
+#define Out_T1 ap_int<10>
+#define InFrac1 2
+#define OutFrac1 5
+
+void Testbench_softmax(stream<ap_uint<PE0*In_T0::width> > & in0, stream<ap_uint<PE0*Out_T0::width> > & out0,
+                    stream<ap_uint<PE1*In_T1::width> > & in1, stream<ap_uint<PE1*Out_T1::width> > & out1, unsigned int numReps);
+
+#endif
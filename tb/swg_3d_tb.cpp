@@ -0,0 +1,162 @@
+/******************************************************************************
+ *  Copyright (c) 2026, Advanced Micro Devices, Inc.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *
+ *  1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *
+ *  2.  Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ *  3.  Neither the name of the copyright holder nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION). HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ *  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************/
+/******************************************************************************
+ *
+ *  \file swg_3d_tb.cpp
+ *
+ *  Testbench for the 3D (spatio-temporal) sliding window generator HLS block
+ *
+ *****************************************************************************/
+#define FINN_HLSLIB_COUNT_ITERATIONS 1
+
+#include <hls_stream.h>
+#include "ap_int.h"
+#include <iostream>
+#include <string>
+#include "costmodel.hpp"
+#include "data/input_gen_3d.h"
+#include "math.h"
+using namespace hls;
+using namespace std;
+
+#define MAX_IMAGES 2
+
+void Testbench_3d(stream<ap_uint<SIMD*INPUT_PRECISION> > & in0, stream<ap_uint<SIMD*INPUT_PRECISION> > & out0,
+                  stream<ap_uint<SIMD*INPUT_PRECISION> > & in1, stream<ap_uint<SIMD*INPUT_PRECISION> > & out1,
+                  stream<ap_uint<SIMD*INPUT_PRECISION> > & in2, stream<ap_uint<SIMD*INPUT_PRECISION> > & out2,
+                  unsigned int numReps);
+
+static	ap_uint<INPUT_PRECISION> INPUT_IMAGES[MAX_IMAGES][IFMDepth][IFMDim][IFMDim][IFM_Channels];
+
+template<unsigned int KernelDim_t, unsigned int KernelDim, unsigned int Stride_t, unsigned int Stride,
+         unsigned int Dilation_t, unsigned int Dilation, unsigned int OFMDepth, unsigned int OFMDim, bool DepthWise>
+int check(stream<ap_uint<SIMD*INPUT_PRECISION> > & out)
+{
+	constexpr unsigned int multiplying_factor = IFM_Channels/SIMD;
+	constexpr unsigned int kernel_size = KernelDim_t*KernelDim*KernelDim;
+	for (unsigned int n_image = 0; n_image < MAX_IMAGES; n_image++) {
+		for (unsigned int ot = 0; ot < OFMDepth; ot++) {
+			for (unsigned int oy = 0; oy < OFMDim; oy++) {
+				for (unsigned int ox = 0; ox < OFMDim; ox++) {
+					for (unsigned int i = 0; i < kernel_size*multiplying_factor; i++) {
+						// kernel pixels innermost for depthwise, channels innermost otherwise
+						unsigned int const k = DepthWise? i % kernel_size : i / multiplying_factor;
+						unsigned int const s = DepthWise? i / kernel_size : i % multiplying_factor;
+						unsigned int const kt = k / (KernelDim*KernelDim);
+						unsigned int const ky = (k / KernelDim) % KernelDim;
+						unsigned int const kx = k % KernelDim;
+						ap_uint<SIMD*INPUT_PRECISION> outElem = out.read();
+						for (unsigned int simd = 0; simd < SIMD; simd++) {
+							ap_uint<INPUT_PRECISION> const out_chan = outElem((simd+1)*INPUT_PRECISION-1, simd*INPUT_PRECISION);
+							ap_uint<INPUT_PRECISION> const EXP = INPUT_IMAGES[n_image][ot*Stride_t+kt*Dilation_t][oy*Stride+ky*Dilation][ox*Stride+kx*Dilation][s*SIMD+simd];
+							if (EXP != out_chan) {
+								std::cout << "ERROR: kernel= " << KernelDim_t << "x" << KernelDim << " Expected " << EXP << " actual " <<  out_chan << std::endl;
+								std::cout << "ot= " << ot << " oy= " << oy << " ox= " << ox << " kt= " << kt << " ky= " << ky << " kx= " << kx << " simd block= " << s << std::endl;
+								return 1;
+							}
+						}
+					}
+				}
+			}
+		}
+	}
+	if (!out.empty()) {
+		std::cout << "ERROR: kernel= " << KernelDim_t << "x" << KernelDim << " left data in the output stream" << std::endl;
+		return 1;
+	}
+	std::cout << "Kernel " << KernelDim_t << "x" << KernelDim << " stride " << Stride_t << "x" << Stride << " dilation " << Dilation_t << "x" << Dilation << " passed the testing." << std::endl;
+	return 0;
+}
+
+template<unsigned int KernelDim_t, unsigned int KernelDim, unsigned int Stride_t, unsigned int Stride, unsigned int Dilation_t,
+         unsigned int Dilation, unsigned int OFMDepth, unsigned int OFMDim>
+int check_cycles(unsigned int const kernel)
+{
+#ifndef __RTL_SIMULATION__
+	constexpr unsigned long long cost_cycles = cost::ConvolutionInputGenerator_3D<KernelDim_t, KernelDim, IFM_Channels, INPUT_PRECISION,
+		IFMDepth, IFMDim, OFMDepth, OFMDim, SIMD, Stride_t, Stride, Dilation_t, Dilation>::cycles_per_image;
+	for (unsigned int n_image = 0; n_image < MAX_IMAGES; n_image++) {
+		unsigned long long const cycles = cost::iteration_log().at(kernel*MAX_IMAGES + n_image);
+		if (cycles > cost_cycles) {
+			std::cout << "ERROR: kernel= " << KernelDim_t << "x" << KernelDim << " took " << cycles << " cycles, cost model "
+			          << cost_cycles << std::endl;
+			return 1;
+		}
+	}
+	std::cout << "Kernel " << KernelDim_t << "x" << KernelDim << " took " << cost::iteration_log()[kernel*MAX_IMAGES]
+	          << " cycles per clip, cost model " << cost_cycles << std::endl;
+#endif
+	return 0;
+}
+
+int main()
+{
+	stream<ap_uint<SIMD*INPUT_PRECISION> > input_stream0("input_stream0");
+	stream<ap_uint<SIMD*INPUT_PRECISION> > input_stream1("input_stream1");
+	stream<ap_uint<SIMD*INPUT_PRECISION> > input_stream2("input_stream2");
+	stream<ap_uint<SIMD*INPUT_PRECISION> > output_stream0("output_stream0");
+	stream<ap_uint<SIMD*INPUT_PRECISION> > output_stream1("output_stream1");
+	stream<ap_uint<SIMD*INPUT_PRECISION> > output_stream2("output_stream2");
+	unsigned int counter = 0;
+	for (unsigned int n_image = 0; n_image < MAX_IMAGES; n_image++) {
+		for (unsigned int t = 0; t < IFMDepth; t++) {
+			for (unsigned int y = 0; y < IFMDim; y++) {
+				for (unsigned int x = 0; x < IFMDim; x++) {
+					for (unsigned int s = 0; s < IFM_Channels/SIMD; s++) {
+						ap_uint<SIMD*INPUT_PRECISION> input_simd = 0;
+						for (unsigned int simd = 0; simd < SIMD; simd++) {
+							ap_uint<INPUT_PRECISION> input = (ap_uint<INPUT_PRECISION>)(counter++);
+							INPUT_IMAGES[n_image][t][y][x][s*SIMD+simd] = input;
+							input_simd((simd+1)*INPUT_PRECISION-1, simd*INPUT_PRECISION) = input;
+						}
+						input_stream0.write(input_simd);
+						input_stream1.write(input_simd);
+						input_stream2.write(input_simd);
+					}
+				}
+			}
+		}
+	}
+	Testbench_3d(input_stream0, output_stream0, input_stream1, output_stream1, input_stream2, output_stream2, MAX_IMAGES);
+	if (!input_stream0.empty() || !input_stream1.empty() || !input_stream2.empty()) {
+		std::cout << "ERROR: left data in the input streams" << std::endl;
+		return 1;
+	}
+	int err = 0;
+	err |= check<KERNEL_DIM_T0, KERNEL_DIM0, STRIDE_T0, STRIDE0, DILATION_T0, DILATION0, OFMDepth0, OFMDim0, false>(output_stream0);
+	err |= check<KERNEL_DIM_T1, KERNEL_DIM1, STRIDE_T1, STRIDE1, DILATION_T1, DILATION1, OFMDepth1, OFMDim1, true>(output_stream1);
+	err |= check<KERNEL_DIM_T2, KERNEL_DIM2, STRIDE_T2, STRIDE2, DILATION_T2, DILATION2, OFMDepth2, OFMDim2, false>(output_stream2);
+	err |= check_cycles<KERNEL_DIM_T0, KERNEL_DIM0, STRIDE_T0, STRIDE0, DILATION_T0, DILATION0, OFMDepth0, OFMDim0>(0);
+	err |= check_cycles<KERNEL_DIM_T1, KERNEL_DIM1, STRIDE_T1, STRIDE1, DILATION_T1, DILATION1, OFMDepth1, OFMDim1>(1);
+	err |= check_cycles<KERNEL_DIM_T2, KERNEL_DIM2, STRIDE_T2, STRIDE2, DILATION_T2, DILATION2, OFMDepth2, OFMDim2>(2);
+	return err;
+}
@@ -0,0 +1,133 @@
+/******************************************************************************
+ *  Copyright (c) 2026, Advanced Micro Devices, Inc.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *
+ *  1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *
+ *  2.  Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ *  3.  Neither the name of the copyright holder nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION). HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ *  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************/
+/******************************************************************************
+ *
+ *  \file swg_dynamic_tb.cpp
+ *
+ *  Testbench for the runtime-configurable sliding window generator HLS block
+ *
+ *****************************************************************************/
+#define FINN_HLSLIB_COUNT_ITERATIONS 1
+
+#include <hls_stream.h>
+#include "ap_int.h"
+#include <iostream>
+#include <string>
+#include "costmodel.hpp"
+#include "data/input_gen_dynamic.h"
+#include "math.h"
+using namespace hls;
+using namespace std;
+
+#define MAX_IMAGES 2
+
+void Testbench_dynamic(stream<ap_uint<SIMD*INPUT_PRECISION> > & in, stream<ap_uint<SIMD*INPUT_PRECISION> > & out,
+                       unsigned int kernel_dim, unsigned int ifm_channels, unsigned int ifm_dim, unsigned int ofm_dim,
+                       unsigned int stride, unsigned int numReps);
+
+// runtime configurations: kernel, channels, input dimension, stride
+static unsigned int const CONFIGS[][4] = {
+	{3, 4, 8, 1},
+	{2, 2, 6, 2},
+	{3, 4, 8, 2},
+	{2, 4, 7, 2},
+	{1, 2, 5, 1},
+	{3, 2, 5, 1}
+};
+
+int main()
+{
+static	ap_uint<INPUT_PRECISION> INPUT_IMAGES[MAX_IMAGES][MAX_IFMDim*MAX_IFMDim][MAX_IFM_Channels];
+	unsigned int counter = 0;
+	for (unsigned int c = 0; c < sizeof(CONFIGS)/sizeof(CONFIGS[0]); c++) {
+		unsigned int const kernel_dim = CONFIGS[c][0];
+		unsigned int const ifm_channels = CONFIGS[c][1];
+		unsigned int const ifm_dim = CONFIGS[c][2];
+		unsigned int const stride = CONFIGS[c][3];
+		unsigned int const ofm_dim = (ifm_dim - kernel_dim)/stride + 1;
+		stream<ap_uint<SIMD*INPUT_PRECISION> > input_stream("input_stream");
+		stream<ap_uint<SIMD*INPUT_PRECISION> > output_stream("output_stream");
+		for (unsigned int n_image = 0; n_image < MAX_IMAGES; n_image++) {
+			for (unsigned int px = 0; px < ifm_dim*ifm_dim; px++) {
+				for (unsigned int channel = 0; channel < ifm_channels; channel += SIMD) {
+					ap_uint<SIMD*INPUT_PRECISION> input_simd = 0;
+					for (unsigned int simd = 0; simd < SIMD; simd++) {
+						ap_uint<INPUT_PRECISION> input = (ap_uint<INPUT_PRECISION>)(counter++);
+						INPUT_IMAGES[n_image][px][channel + simd] = input;
+						input_simd((simd+1)*INPUT_PRECISION-1, simd*INPUT_PRECISION) = input;
+					}
+					input_stream.write(input_simd);
+				}
+			}
+		}
+		Testbench_dynamic(input_stream, output_stream, kernel_dim, ifm_channels, ifm_dim, ofm_dim, stride, MAX_IMAGES);
+		for (unsigned int n_image = 0; n_image < MAX_IMAGES; n_image++) {
+			for (unsigned int oy = 0; oy < ofm_dim; oy++) {
+				for (unsigned int ox = 0; ox < ofm_dim; ox++) {
+					for (unsigned int ky = 0; ky < kernel_dim; ky++) {
+						for (unsigned int kx = 0; kx < kernel_dim; kx++) {
+							unsigned int input_ind = (oy*stride + ky) * ifm_dim + (ox*stride + kx);
+							for (unsigned int channel = 0; channel < ifm_channels; channel += SIMD) {
+								ap_uint<SIMD*INPUT_PRECISION> outElem = output_stream.read();
+								for (unsigned int simd = 0; simd < SIMD; simd++) {
+									ap_uint<INPUT_PRECISION> out_chan = outElem((simd+1)*INPUT_PRECISION-1, simd*INPUT_PRECISION);
+									if (INPUT_IMAGES[n_image][input_ind][channel + simd] != out_chan) {
+										std::cout << "ERROR: " <<  " Expected " << INPUT_IMAGES[n_image][input_ind][channel + simd] << " actual " <<  out_chan << std::endl;
+										std::cout << "config= " << c << " oy= " << oy << " ox= " << ox << " ky= " << ky << " kx= " << kx << std::endl;
+										return 1;
+									}
+								}
+							}
+						}
+					}
+				}
+			}
+		}
+		if (!input_stream.empty() || !output_stream.empty()) {
+			std::cout << "ERROR: config= " << c << " left data in the streams" << std::endl;
+			return 1;
+		}
+#ifndef __RTL_SIMULATION__
+		unsigned long long const expected_cycles = cost::ConvolutionInputGenerator_dynamic<MAX_KERNEL_DIM, MAX_IFM_Channels,
+			INPUT_PRECISION, MAX_IFMDim, SIMD, MAX_STRIDE>::cycles_per_image(kernel_dim, ifm_channels, ifm_dim, ofm_dim, stride);
+		for (unsigned int n_image = 0; n_image < MAX_IMAGES; n_image++) {
+			unsigned long long const cycles = cost::iteration_log().at(c*MAX_IMAGES + n_image);
+			if (cycles != expected_cycles) {
+				std::cout << "ERROR: config= " << c << " took " << cycles << " cycles, cost model " << expected_cycles << std::endl;
+				return 1;
+			}
+		}
+#endif
+		std::cout << "Configuration # " << c << " passed the testing." << std::endl;
+	}
+	return 0;
+}
@@ -0,0 +1,174 @@
+/******************************************************************************
+ *  Copyright (c) 2026, Advanced Micro Devices, Inc.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *
+ *  1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *
+ *  2.  Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ *  3.  Neither the name of the copyright holder nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION). HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ *  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************/
+/******************************************************************************
+ *
+ *  \file swg_generic_tb.cpp
+ *
+ *  Testbench for the sliding window generator HLS block supporting any kernel,
+ *  stride and dilation combination
+ *
+ *****************************************************************************/
+#define FINN_HLSLIB_COUNT_ITERATIONS 1
+
+#include <hls_stream.h>
+#include "ap_int.h"
+#include <iostream>
+#include <string>
+#include "mmv.hpp"
+#include "costmodel.hpp"
+#include "data/input_gen_generic.h"
+#include "math.h"
+using namespace hls;
+using namespace std;
+
+#define MAX_IMAGES 2
+
+void Testbench_generic(stream<ap_uint<SIMD*INPUT_PRECISION> > & in0, stream<ap_uint<SIMD*INPUT_PRECISION> > & out0,
+                       stream<ap_uint<SIMD*INPUT_PRECISION> > & in1, stream<ap_uint<SIMD*INPUT_PRECISION> > & out1,
+                       stream<ap_uint<SIMD*INPUT_PRECISION> > & in2, stream<ap_uint<SIMD*INPUT_PRECISION> > & out2,
+                       stream<ap_uint<SIMD*INPUT_PRECISION> > & in3, stream<MultiChanData<MMV3, SIMD*INPUT_PRECISION> > & out3,
+                       unsigned int numReps);
+
+static	ap_uint<INPUT_PRECISION> INPUT_IMAGES[MAX_IMAGES][IFMDim][IFMDim][IFM_Channels];
+
+ap_uint<SIMD*INPUT_PRECISION> get_pixel(ap_uint<SIMD*INPUT_PRECISION> const &outElem, unsigned int const) {
+	return outElem;
+}
+template<unsigned int MMV>
+ap_uint<SIMD*INPUT_PRECISION> get_pixel(MultiChanData<MMV, SIMD*INPUT_PRECISION> const &outElem, unsigned int const mmv) {
+	return outElem.data[mmv];
+}
+
+template<unsigned int KernelDim, unsigned int Stride, unsigned int Dilation, unsigned int OFMDim, unsigned int MMV, bool DepthWise, typename TO>
+int check(stream<TO> & out)
+{
+	constexpr unsigned int multiplying_factor = IFM_Channels/SIMD;
+	for (unsigned int n_image = 0; n_image < MAX_IMAGES; n_image++) {
+		for (unsigned int oy = 0; oy < OFMDim; oy++) {
+			for (unsigned int ox = 0; ox < OFMDim; ox += MMV) {
+				for (unsigned int i = 0; i < KernelDim*KernelDim*multiplying_factor; i++) {
+					// kernel pixels innermost for depthwise, channels innermost otherwise
+					unsigned int const k = DepthWise? i % (KernelDim*KernelDim) : i / multiplying_factor;
+					unsigned int const s = DepthWise? i / (KernelDim*KernelDim) : i % multiplying_factor;
+					unsigned int const ky = k / KernelDim;
+					unsigned int const kx = k % KernelDim;
+					TO outElem = out.read();
+					for (unsigned int v = 0; v < MMV; v++) {
+						ap_uint<SIMD*INPUT_PRECISION> const pixel = get_pixel(outElem, v);
+						for (unsigned int simd = 0; simd < SIMD; simd++) {
+							ap_uint<INPUT_PRECISION> const out_chan = pixel((simd+1)*INPUT_PRECISION-1, simd*INPUT_PRECISION);
+							ap_uint<INPUT_PRECISION> const EXP = INPUT_IMAGES[n_image][oy*Stride+ky*Dilation][(ox+v)*Stride+kx*Dilation][s*SIMD+simd];
+							if (EXP != out_chan) {
+								std::cout << "ERROR: kernel= " << KernelDim << " stride= " << Stride << " dilation= " << Dilation << " Expected " << EXP << " actual " <<  out_chan << std::endl;
+								std::cout << "oy= " << oy << " ox= " << ox+v << " ky= " << ky << " kx= " << kx << " simd block= " << s << std::endl;
+								return 1;
+							}
+						}
+					}
+				}
+			}
+		}
+	}
+	if (!out.empty()) {
+		std::cout << "ERROR: kernel= " << KernelDim << " stride= " << Stride << " left data in the output stream" << std::endl;
+		return 1;
+	}
+	std::cout << "Kernel " << KernelDim << " stride " << Stride << " dilation " << Dilation << " MMV " << MMV << " passed the testing." << std::endl;
+	return 0;
+}
+
+template<unsigned int KernelDim, unsigned int Stride, unsigned int Dilation, unsigned int OFMDim, unsigned int MMV>
+int check_cycles(unsigned int const kernel)
+{
+#ifndef __RTL_SIMULATION__
+	constexpr unsigned long long cost_cycles = cost::ConvolutionInputGenerator_generic<KernelDim, IFM_Channels, INPUT_PRECISION,
+		IFMDim, OFMDim, SIMD, Stride, Dilation, MMV>::cycles_per_image;
+	for (unsigned int n_image = 0; n_image < MAX_IMAGES; n_image++) {
+		unsigned long long const cycles = cost::iteration_log().at(kernel*MAX_IMAGES + n_image);
+		if (cycles > cost_cycles) {
+			std::cout << "ERROR: kernel= " << KernelDim << " stride= " << Stride << " dilation= " << Dilation << " took " << cycles
+			          << " cycles, cost model " << cost_cycles << std::endl;
+			return 1;
+		}
+	}
+	std::cout << "Kernel " << KernelDim << " stride " << Stride << " dilation " << Dilation << " took " << cost::iteration_log()[kernel*MAX_IMAGES]
+	          << " cycles per image, cost model " << cost_cycles << std::endl;
+#endif
+	return 0;
+}
+
+int main()
+{
+	stream<ap_uint<SIMD*INPUT_PRECISION> > input_stream0("input_stream0");
+	stream<ap_uint<SIMD*INPUT_PRECISION> > input_stream1("input_stream1");
+	stream<ap_uint<SIMD*INPUT_PRECISION> > input_stream2("input_stream2");
+	stream<ap_uint<SIMD*INPUT_PRECISION> > input_stream3("input_stream3");
+	stream<ap_uint<SIMD*INPUT_PRECISION> > output_stream0("output_stream0");
+	stream<ap_uint<SIMD*INPUT_PRECISION> > output_stream1("output_stream1");
+	stream<ap_uint<SIMD*INPUT_PRECISION> > output_stream2("output_stream2");
+	stream<MultiChanData<MMV3, SIMD*INPUT_PRECISION> > output_stream3("output_stream3");
+	unsigned int counter = 0;
+	for (unsigned int n_image = 0; n_image < MAX_IMAGES; n_image++) {
+		for (unsigned int oy = 0; oy < IFMDim; oy++) {
+			for (unsigned int ox = 0; ox < IFMDim; ox++) {
+				for (unsigned int s = 0; s < IFM_Channels/SIMD; s++) {
+					ap_uint<SIMD*INPUT_PRECISION> input_simd = 0;
+					for (unsigned int simd = 0; simd < SIMD; simd++) {
+						ap_uint<INPUT_PRECISION> input = (ap_uint<INPUT_PRECISION>)(counter++);
+						INPUT_IMAGES[n_image][oy][ox][s*SIMD+simd] = input;
+						input_simd((simd+1)*INPUT_PRECISION-1, simd*INPUT_PRECISION) = input;
+					}
+					input_stream0.write(input_simd);
+					input_stream1.write(input_simd);
+					input_stream2.write(input_simd);
+					input_stream3.write(input_simd);
+				}
+			}
+		}
+	}
+	Testbench_generic(input_stream0, output_stream0, input_stream1, output_stream1,
+	                  input_stream2, output_stream2, input_stream3, output_stream3, MAX_IMAGES);
+	if (!input_stream0.empty() || !input_stream1.empty() || !input_stream2.empty() || !input_stream3.empty()) {
+		std::cout << "ERROR: left data in the input streams" << std::endl;
+		return 1;
+	}
+	int err = 0;
+	err |= check<KERNEL_DIM0, STRIDE0, DILATION0, OFMDim0, 1, false>(output_stream0);
+	err |= check<KERNEL_DIM1, STRIDE1, DILATION1, OFMDim1, 1, true>(output_stream1);
+	err |= check<KERNEL_DIM2, STRIDE2, DILATION2, OFMDim2, 1, false>(output_stream2);
+	err |= check<KERNEL_DIM3, STRIDE3, DILATION3, OFMDim3, MMV3, true>(output_stream3);
+	err |= check_cycles<KERNEL_DIM0, STRIDE0, DILATION0, OFMDim0, 1>(0);
+	err |= check_cycles<KERNEL_DIM1, STRIDE1, DILATION1, OFMDim1, 1>(1);
+	err |= check_cycles<KERNEL_DIM2, STRIDE2, DILATION2, OFMDim2, 1>(2);
+	err |= check_cycles<KERNEL_DIM3, STRIDE3, DILATION3, OFMDim3, MMV3>(3);
+	return err;
+}
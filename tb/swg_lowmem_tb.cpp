@@ -0,0 +1,187 @@
+/******************************************************************************
+ *  Copyright (c) 2026, Advanced Micro Devices, Inc.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *
+ *  1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *
+ *  2.  Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ *  3.  Neither the name of the copyright holder nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION). HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ *  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************/
+/******************************************************************************
+ *
+ *  \file swg_lowmem_tb.cpp
+ *
+ *  Testbench for the sliding window generator HLS block using a reduced
+ *  circular line buffer
+ *
+ *****************************************************************************/
+#define FINN_HLSLIB_COUNT_ITERATIONS 1
+
+#include <hls_stream.h>
+#include "ap_int.h"
+#include <iostream>
+#include <string>
+#include "costmodel.hpp"
+#include "data/input_gen_lowmem.h"
+#include "math.h"
+using namespace hls;
+using namespace std;
+
+#define MAX_IMAGES 2
+
+void Testbench_lowmem(stream<ap_uint<SIMD*INPUT_PRECISION> > & in0, stream<ap_uint<SIMD*INPUT_PRECISION> > & out0,
+                      stream<ap_uint<SIMD*INPUT_PRECISION> > & in1, stream<ap_uint<SIMD*INPUT_PRECISION> > & out1,
+                      stream<ap_uint<SIMD*INPUT_PRECISION> > & in2, stream<ap_uint<SIMD*INPUT_PRECISION> > & out2,
+                      stream<ap_uint<SIMD*INPUT_PRECISION> > & in3, stream<ap_uint<SIMD*INPUT_PRECISION> > & out3,
+                      stream<ap_uint<SIMD*INPUT_PRECISION> > & in4, stream<ap_uint<SIMD*INPUT_PRECISION> > & out4,
+                      stream<ap_uint<SIMD*INPUT_PRECISION> > & in5, stream<ap_uint<SIMD*INPUT_PRECISION> > & out5,
+                      unsigned int numReps);
+
+static	ap_uint<INPUT_PRECISION> INPUT_IMAGES[MAX_IMAGES][IFMDim][IFMDim][IFM_Channels];
+static	ap_uint<INPUT_PRECISION> INPUT_IMAGES_T[MAX_IMAGES][IFMDim_T][IFMDim_T][IFM_Channels];
+
+template<unsigned int Dim, unsigned int Streams>
+void generate(ap_uint<INPUT_PRECISION> images[MAX_IMAGES][Dim][Dim][IFM_Channels],
+              stream<ap_uint<SIMD*INPUT_PRECISION> > * const (&in)[Streams])
+{
+	unsigned int counter = 0;
+	for (unsigned int n_image = 0; n_image < MAX_IMAGES; n_image++) {
+		for (unsigned int oy = 0; oy < Dim; oy++) {
+			for (unsigned int ox = 0; ox < Dim; ox++) {
+				for (unsigned int s = 0; s < IFM_Channels/SIMD; s++) {
+					ap_uint<SIMD*INPUT_PRECISION> input_simd = 0;
+					for (unsigned int simd = 0; simd < SIMD; simd++) {
+						ap_uint<INPUT_PRECISION> input = (ap_uint<INPUT_PRECISION>)(counter++);
+						images[n_image][oy][ox][s*SIMD+simd] = input;
+						input_simd((simd+1)*INPUT_PRECISION-1, simd*INPUT_PRECISION) = input;
+					}
+					for (unsigned int i = 0; i < Streams; i++) {
+						in[i]->write(input_simd);
+					}
+				}
+			}
+		}
+	}
+}
+
+template<unsigned int Dim, unsigned int KernelDim, unsigned int Stride, unsigned int OFMDim>
+int check(ap_uint<INPUT_PRECISION> images[MAX_IMAGES][Dim][Dim][IFM_Channels], stream<ap_uint<SIMD*INPUT_PRECISION> > & out)
+{
+	constexpr unsigned int multiplying_factor = IFM_Channels/SIMD;
+	for (unsigned int n_image = 0; n_image < MAX_IMAGES; n_image++) {
+		for (unsigned int oy = 0; oy < OFMDim; oy++) {
+			for (unsigned int ox = 0; ox < OFMDim; ox++) {
+				for (unsigned int ky = 0; ky < KernelDim; ky++) {
+					for (unsigned int kx = 0; kx < KernelDim; kx++) {
+						for (unsigned int s = 0; s < multiplying_factor; s++) {
+							ap_uint<SIMD*INPUT_PRECISION> outElem = out.read();
+							for (unsigned int simd = 0; simd < SIMD; simd++) {
+								ap_uint<INPUT_PRECISION> const out_chan = outElem((simd+1)*INPUT_PRECISION-1, simd*INPUT_PRECISION);
+								ap_uint<INPUT_PRECISION> const EXP = images[n_image][oy*Stride+ky][ox*Stride+kx][s*SIMD+simd];
+								if (EXP != out_chan) {
+									std::cout << "ERROR: kernel= " << KernelDim << " stride= " << Stride << " Expected " << EXP << " actual " <<  out_chan << std::endl;
+									std::cout << "oy= " << oy << " ox= " << ox << " ky= " << ky << " kx= " << kx << " simd block= " << s << std::endl;
+									return 1;
+								}
+							}
+						}
+					}
+				}
+			}
+		}
+	}
+	if (!out.empty()) {
+		std::cout << "ERROR: kernel= " << KernelDim << " stride= " << Stride << " left data in the output stream" << std::endl;
+		return 1;
+	}
+	std::cout << "Kernel " << KernelDim << " stride " << Stride << " passed the testing." << std::endl;
+	return 0;
+}
+
+// the loop iterations of every image of the kernel-th instance must stay within its cost entry and
+// the cycles of ConvolutionInputGenerator
+template<unsigned int Dim, unsigned int KernelDim, unsigned int Stride, unsigned int OFMDim, unsigned int PackedGroups = 1>
+int check_cycles(unsigned int const kernel)
+{
+#ifndef __RTL_SIMULATION__
+	constexpr unsigned long long lowmem_cycles = cost::ConvolutionInputGenerator_lowmem<KernelDim, IFM_Channels, INPUT_PRECISION,
+		Dim, OFMDim, SIMD, Stride, PackedGroups>::cycles_per_image;
+	constexpr unsigned long long baseline_cycles = cost::ConvolutionInputGenerator<KernelDim, IFM_Channels, INPUT_PRECISION,
+		Dim, OFMDim, SIMD, Stride>::cycles_per_image;
+	for (unsigned int n_image = 0; n_image < MAX_IMAGES; n_image++) {
+		unsigned long long const cycles = cost::iteration_log().at(kernel*MAX_IMAGES + n_image);
+		if ((cycles > lowmem_cycles) || (cycles > baseline_cycles)) {
+			std::cout << "ERROR: kernel= " << KernelDim << " stride= " << Stride << " took " << cycles << " cycles, cost model "
+			          << lowmem_cycles << ", ConvolutionInputGenerator " << baseline_cycles << std::endl;
+			return 1;
+		}
+	}
+	std::cout << "Kernel " << KernelDim << " stride " << Stride << " took " << cost::iteration_log()[kernel*MAX_IMAGES]
+	          << " cycles per image, ConvolutionInputGenerator " << baseline_cycles << std::endl;
+#endif
+	return 0;
+}
+
+int main()
+{
+	stream<ap_uint<SIMD*INPUT_PRECISION> > input_stream0("input_stream0");
+	stream<ap_uint<SIMD*INPUT_PRECISION> > input_stream1("input_stream1");
+	stream<ap_uint<SIMD*INPUT_PRECISION> > input_stream2("input_stream2");
+	stream<ap_uint<SIMD*INPUT_PRECISION> > input_stream3("input_stream3");
+	stream<ap_uint<SIMD*INPUT_PRECISION> > input_stream4("input_stream4");
+	stream<ap_uint<SIMD*INPUT_PRECISION> > input_stream5("input_stream5");
+	stream<ap_uint<SIMD*INPUT_PRECISION> > output_stream0("output_stream0");
+	stream<ap_uint<SIMD*INPUT_PRECISION> > output_stream1("output_stream1");
+	stream<ap_uint<SIMD*INPUT_PRECISION> > output_stream2("output_stream2");
+	stream<ap_uint<SIMD*INPUT_PRECISION> > output_stream3("output_stream3");
+	stream<ap_uint<SIMD*INPUT_PRECISION> > output_stream4("output_stream4");
+	stream<ap_uint<SIMD*INPUT_PRECISION> > output_stream5("output_stream5");
+	stream<ap_uint<SIMD*INPUT_PRECISION> > * const inputs[] = { &input_stream0, &input_stream1, &input_stream2, &input_stream3 };
+	stream<ap_uint<SIMD*INPUT_PRECISION> > * const inputs_t[] = { &input_stream4, &input_stream5 };
+	generate<IFMDim>(INPUT_IMAGES, inputs);
+	generate<IFMDim_T>(INPUT_IMAGES_T, inputs_t);
+	Testbench_lowmem(input_stream0, output_stream0, input_stream1, output_stream1,
+	                 input_stream2, output_stream2, input_stream3, output_stream3,
+	                 input_stream4, output_stream4, input_stream5, output_stream5, MAX_IMAGES);
+	if (!input_stream0.empty() || !input_stream1.empty() || !input_stream2.empty() || !input_stream3.empty() ||
+	    !input_stream4.empty() || !input_stream5.empty()) {
+		std::cout << "ERROR: left data in the input streams" << std::endl;
+		return 1;
+	}
+	int err = 0;
+	err |= check<IFMDim, KERNEL_DIM0, STRIDE0, OFMDim0>(INPUT_IMAGES, output_stream0);
+	err |= check<IFMDim, KERNEL_DIM1, STRIDE1, OFMDim1>(INPUT_IMAGES, output_stream1);
+	err |= check<IFMDim, KERNEL_DIM2, STRIDE2, OFMDim2>(INPUT_IMAGES, output_stream2);
+	err |= check<IFMDim, KERNEL_DIM3, STRIDE3, OFMDim3>(INPUT_IMAGES, output_stream3);
+	err |= check<IFMDim_T, KERNEL_DIM4, STRIDE4, OFMDim4>(INPUT_IMAGES_T, output_stream4);
+	err |= check<IFMDim_T, KERNEL_DIM5, STRIDE5, OFMDim5>(INPUT_IMAGES_T, output_stream5);
+	err |= check_cycles<IFMDim, KERNEL_DIM0, STRIDE0, OFMDim0>(0);
+	err |= check_cycles<IFMDim, KERNEL_DIM1, STRIDE1, OFMDim1>(1);
+	err |= check_cycles<IFMDim, KERNEL_DIM2, STRIDE2, OFMDim2>(2);
+	err |= check_cycles<IFMDim, KERNEL_DIM3, STRIDE3, OFMDim3>(3);
+	err |= check_cycles<IFMDim_T, KERNEL_DIM4, STRIDE4, OFMDim4>(4);
+	err |= check_cycles<IFMDim_T, KERNEL_DIM5, STRIDE5, OFMDim5, PACKED5>(5);
+	return err;
+}
@@ -0,0 +1,154 @@
+/******************************************************************************
+ *  Copyright (c) 2026, Advanced Micro Devices, Inc.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *
+ *  1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *
+ *  2.  Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ *  3.  Neither the name of the copyright holder nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION). HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ *  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************/
+/******************************************************************************
+ *
+ *  \file swg_nonsquare_mmv_tb.cpp
+ *
+ *  Testbench for the non-square and dilated sliding window generator HLS blocks
+ *  with MMV support
+ *
+ *****************************************************************************/
+#include <hls_stream.h>
+#include "ap_int.h"
+#include <iostream>
+#include <string>
+#include "mmv.hpp"
+#include "data/input_gen_nonsquare_mmv.h"
+#include "math.h"
+using namespace hls;
+using namespace std;
+
+#define MAX_IMAGES 2
+#define MAX_DIM 17
+
+void Testbench_nonsquare_mmv(stream<ap_uint<SIMD*INPUT_PRECISION> > & in0, stream<MultiChanData<MMV0, SIMD*INPUT_PRECISION> > & out0,
+                             stream<ap_uint<SIMD*INPUT_PRECISION> > & in1, stream<MultiChanData<MMV1, SIMD*INPUT_PRECISION> > & out1,
+                             stream<ap_uint<SIMD*INPUT_PRECISION> > & in2, stream<MultiChanData<MMV2, SIMD*INPUT_PRECISION> > & out2,
+                             stream<ap_uint<SIMD*INPUT_PRECISION> > & in3, stream<MultiChanData<MMV3, SIMD*INPUT_PRECISION> > & out3,
+                             unsigned int numReps);
+
+static	ap_uint<INPUT_PRECISION> INPUT_IMAGES[MAX_IMAGES][MAX_DIM][MAX_DIM][IFM_Channels];
+
+template<unsigned int IFMDim_x, unsigned int IFMDim_y>
+void fill(stream<ap_uint<SIMD*INPUT_PRECISION> > & in)
+{
+	for (unsigned int n_image = 0; n_image < MAX_IMAGES; n_image++) {
+		for (unsigned int oy = 0; oy < IFMDim_y; oy++) {
+			for (unsigned int ox = 0; ox < IFMDim_x; ox++) {
+				for (unsigned int s = 0; s < IFM_Channels/SIMD; s++) {
+					ap_uint<SIMD*INPUT_PRECISION> input_simd = 0;
+					for (unsigned int simd = 0; simd < SIMD; simd++) {
+						input_simd((simd+1)*INPUT_PRECISION-1, simd*INPUT_PRECISION) = INPUT_IMAGES[n_image][oy][ox][s*SIMD+simd];
+					}
+					in.write(input_simd);
+				}
+			}
+		}
+	}
+}
+
+template<unsigned int KernelDim_x, unsigned int KernelDim_y, unsigned int Stride_x, unsigned int Stride_y, unsigned int Dilation_x,
+         unsigned int OFMDim_x, unsigned int OFMDim_y, unsigned int MMV, bool DepthWise>
+int check(stream<MultiChanData<MMV, SIMD*INPUT_PRECISION> > & out)
+{
+	constexpr unsigned int multiplying_factor = IFM_Channels/SIMD;
+	constexpr unsigned int kernel_pixels = KernelDim_x*KernelDim_y;
+	for (unsigned int n_image = 0; n_image < MAX_IMAGES; n_image++) {
+		for (unsigned int oy = 0; oy < OFMDim_y; oy++) {
+			for (unsigned int ox = 0; ox < OFMDim_x; ox += MMV) {
+				for (unsigned int i = 0; i < kernel_pixels*multiplying_factor; i++) {
+					// kernel pixels innermost for depthwise, channels innermost otherwise
+					unsigned int const k = DepthWise? i % kernel_pixels : i / multiplying_factor;
+					unsigned int const s = DepthWise? i / kernel_pixels : i % multiplying_factor;
+					unsigned int const ky = k / KernelDim_x;
+					unsigned int const kx = k % KernelDim_x;
+					MultiChanData<MMV, SIMD*INPUT_PRECISION> outElem = out.read();
+					for (unsigned int v = 0; v < MMV; v++) {
+						for (unsigned int simd = 0; simd < SIMD; simd++) {
+							ap_uint<INPUT_PRECISION> const out_chan = outElem.data[v]((simd+1)*INPUT_PRECISION-1, simd*INPUT_PRECISION);
+							ap_uint<INPUT_PRECISION> const EXP = INPUT_IMAGES[n_image][oy*Stride_y+ky][(ox+v)*Stride_x+kx*Dilation_x][s*SIMD+simd];
+							if (EXP != out_chan) {
+								std::cout << "ERROR: kernel= " << KernelDim_x << "x" << KernelDim_y << " MMV= " << MMV << " Expected " << EXP << " actual " <<  out_chan << std::endl;
+								std::cout << "oy= " << oy << " ox= " << ox+v << " ky= " << ky << " kx= " << kx << " simd block= " << s << std::endl;
+								return 1;
+							}
+						}
+					}
+				}
+			}
+		}
+	}
+	if (!out.empty()) {
+		std::cout << "ERROR: kernel= " << KernelDim_x << "x" << KernelDim_y << " left data in the output stream" << std::endl;
+		return 1;
+	}
+	std::cout << "Kernel " << KernelDim_x << "x" << KernelDim_y << " stride " << Stride_x << "x" << Stride_y << " MMV " << MMV << " passed the testing." << std::endl;
+	return 0;
+}
+
+int main()
+{
+	stream<ap_uint<SIMD*INPUT_PRECISION> > input_stream0("input_stream0");
+	stream<ap_uint<SIMD*INPUT_PRECISION> > input_stream1("input_stream1");
+	stream<ap_uint<SIMD*INPUT_PRECISION> > input_stream2("input_stream2");
+	stream<ap_uint<SIMD*INPUT_PRECISION> > input_stream3("input_stream3");
+	stream<MultiChanData<MMV0, SIMD*INPUT_PRECISION> > output_stream0("output_stream0");
+	stream<MultiChanData<MMV1, SIMD*INPUT_PRECISION> > output_stream1("output_stream1");
+	stream<MultiChanData<MMV2, SIMD*INPUT_PRECISION> > output_stream2("output_stream2");
+	stream<MultiChanData<MMV3, SIMD*INPUT_PRECISION> > output_stream3("output_stream3");
+	unsigned int counter = 0;
+	for (unsigned int n_image = 0; n_image < MAX_IMAGES; n_image++) {
+		for (unsigned int oy = 0; oy < MAX_DIM; oy++) {
+			for (unsigned int ox = 0; ox < MAX_DIM; ox++) {
+				for (unsigned int channel = 0; channel < IFM_Channels; channel++) {
+					INPUT_IMAGES[n_image][oy][ox][channel] = (ap_uint<INPUT_PRECISION>)(counter++);
+				}
+			}
+		}
+	}
+	fill<IFMDim_X0, IFMDim_Y0>(input_stream0);
+	fill<IFMDim_X1, IFMDim_Y1>(input_stream1);
+	fill<IFMDim_X2, IFMDim_Y2>(input_stream2);
+	fill<IFMDim_X3, IFMDim_Y3>(input_stream3);
+	Testbench_nonsquare_mmv(input_stream0, output_stream0, input_stream1, output_stream1,
+	                        input_stream2, output_stream2, input_stream3, output_stream3, MAX_IMAGES);
+	if (!input_stream0.empty() || !input_stream1.empty() || !input_stream2.empty() || !input_stream3.empty()) {
+		std::cout << "ERROR: left data in the input streams" << std::endl;
+		return 1;
+	}
+	int err = 0;
+	err |= check<KERNEL_DIM_X0, KERNEL_DIM_Y0, STRIDE_X0, STRIDE_Y0, 1, OFMDim_X0, OFMDim_Y0, MMV0, false>(output_stream0);
+	err |= check<KERNEL_DIM_X1, KERNEL_DIM_Y1, STRIDE_X1, STRIDE_Y1, 1, OFMDim_X1, OFMDim_Y1, MMV1, false>(output_stream1);
+	err |= check<KERNEL_DIM_X2, KERNEL_DIM_Y2, STRIDE_X2, STRIDE_Y2, 1, OFMDim_X2, OFMDim_Y2, MMV2, true>(output_stream2);
+	err |= check<KERNEL_DIM_X3, KERNEL_DIM_Y3, STRIDE_X3, STRIDE_Y3, DILATION_X3, OFMDim_X3, OFMDim_Y3, MMV3, false>(output_stream3);
+	return err;
+}
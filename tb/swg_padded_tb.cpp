@@ -0,0 +1,137 @@
+/******************************************************************************
+ *  Copyright (c) 2026, Advanced Micro Devices, Inc.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *
+ *  1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *
+ *  2.  Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ *  3.  Neither the name of the copyright holder nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION). HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ *  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************/
+/******************************************************************************
+ *
+ *  \file swg_padded_tb.cpp
+ *
+ *  Testbench for the sliding window generator HLS block with fused padding
+ *
+ *****************************************************************************/
+#include <hls_stream.h>
+#include "ap_int.h"
+#include <iostream>
+#include <string>
+#include <algorithm>
+#include "data/input_gen_padded.h"
+#include "math.h"
+using namespace hls;
+using namespace std;
+
+#define MAX_IMAGES 2
+
+void Testbench_padded(stream<ap_uint<SIMD*INPUT_PRECISION> > & in_zero, stream<ap_uint<SIMD*INPUT_PRECISION> > & out_zero,
+                      stream<ap_uint<SIMD*INPUT_PRECISION> > & in_const, stream<ap_uint<SIMD*INPUT_PRECISION> > & out_const,
+                      stream<ap_uint<SIMD*INPUT_PRECISION> > & in_replicate, stream<ap_uint<SIMD*INPUT_PRECISION> > & out_replicate,
+                      unsigned int numReps);
+
+static	ap_uint<INPUT_PRECISION> INPUT_IMAGES[MAX_IMAGES][IFMDim][IFMDim][IFM_Channels];
+
+// check the windows of the padded feature map, mode 0: zero, 1: constant, 2: replicate
+int check(stream<ap_uint<SIMD*INPUT_PRECISION> > & out, unsigned int mode, unsigned int kernel_dim, unsigned int stride,
+          unsigned int pad_before, unsigned int ofm_dim)
+{
+	for (unsigned int n_image = 0; n_image < MAX_IMAGES; n_image++) {
+		for (unsigned int oy = 0; oy < ofm_dim; oy++) {
+			for (unsigned int ox = 0; ox < ofm_dim; ox++) {
+				for (unsigned int ky = 0; ky < kernel_dim; ky++) {
+					for (unsigned int kx = 0; kx < kernel_dim; kx++) {
+						int y = int(oy*stride + ky) - int(pad_before);
+						int x = int(ox*stride + kx) - int(pad_before);
+						bool const padded = (y < 0) || (y >= IFMDim) || (x < 0) || (x >= IFMDim);
+						y = std::min(std::max(y, 0), IFMDim-1);
+						x = std::min(std::max(x, 0), IFMDim-1);
+						for (unsigned int channel = 0; channel < IFM_Channels; channel += SIMD) {
+							ap_uint<SIMD*INPUT_PRECISION> outElem = out.read();
+							for (unsigned int simd = 0; simd < SIMD; simd++) {
+								ap_uint<INPUT_PRECISION> const out_chan = outElem((simd+1)*INPUT_PRECISION-1, simd*INPUT_PRECISION);
+								ap_uint<INPUT_PRECISION> EXP = INPUT_IMAGES[n_image][y][x][channel + simd];
+								if (padded && (mode == 0)) {
+									EXP = 0;
+								}
+								if (padded && (mode == 1)) {
+									EXP = PAD_VALUE;
+								}
+								if (EXP != out_chan) {
+									std::cout << "ERROR: mode= " << mode << " Expected " << EXP << " actual " <<  out_chan << std::endl;
+									std::cout << "oy= " << oy << " ox= " << ox << " ky= " << ky << " kx= " << kx << std::endl;
+									return 1;
+								}
+							}
+						}
+					}
+				}
+			}
+		}
+	}
+	if (!out.empty()) {
+		std::cout << "ERROR: mode= " << mode << " left data in the output stream" << std::endl;
+		return 1;
+	}
+	std::cout << "Padding mode # " << mode << " passed the testing." << std::endl;
+	return 0;
+}
+
+int main()
+{
+	stream<ap_uint<SIMD*INPUT_PRECISION> > input_stream[3];
+	stream<ap_uint<SIMD*INPUT_PRECISION> > output_stream[3];
+	unsigned int counter = 0;
+	for (unsigned int n_image = 0; n_image < MAX_IMAGES; n_image++) {
+		for (unsigned int oy = 0; oy < IFMDim; oy++) {
+			for (unsigned int ox = 0; ox < IFMDim; ox++) {
+				for (unsigned int channel = 0; channel < IFM_Channels; channel += SIMD) {
+					ap_uint<SIMD*INPUT_PRECISION> input_simd = 0;
+					for (unsigned int simd = 0; simd < SIMD; simd++) {
+						ap_uint<INPUT_PRECISION> input = (ap_uint<INPUT_PRECISION>)(counter++);
+						INPUT_IMAGES[n_image][oy][ox][channel + simd] = input;
+						input_simd((simd+1)*INPUT_PRECISION-1, simd*INPUT_PRECISION) = input;
+					}
+					for (unsigned int mode = 0; mode < 3; mode++) {
+						input_stream[mode].write(input_simd);
+					}
+				}
+			}
+		}
+	}
+	Testbench_padded(input_stream[0], output_stream[0], input_stream[1], output_stream[1], input_stream[2], output_stream[2], MAX_IMAGES);
+	for (unsigned int mode = 0; mode < 3; mode++) {
+		if (!input_stream[mode].empty()) {
+			std::cout << "ERROR: mode= " << mode << " left data in the input stream" << std::endl;
+			return 1;
+		}
+	}
+	int err = 0;
+	err |= check(output_stream[0], 0, KERNEL_DIM0, STRIDE0, PAD_BEFORE0, OFMDim0);
+	err |= check(output_stream[1], 1, KERNEL_DIM1, STRIDE1, PAD_BEFORE1, OFMDim1);
+	err |= check(output_stream[2], 2, KERNEL_DIM2, STRIDE2, PAD_BEFORE2, OFMDim2);
+	return err;
+}
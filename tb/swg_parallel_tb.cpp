@@ -0,0 +1,119 @@
+/******************************************************************************
+ *  Copyright (c) 2026, Advanced Micro Devices, Inc.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *
+ *  1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *
+ *  2.  Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ *  3.  Neither the name of the copyright holder nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION). HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ *  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************/
+/******************************************************************************
+ *
+ *  \file swg_parallel_tb.cpp
+ *
+ *  Testbench for the sliding window generator HLS block producing a full window
+ *  per cycle
+ *
+ *****************************************************************************/
+#include <hls_stream.h>
+#include "ap_int.h"
+#include <iostream>
+#include <string>
+#include "data/input_gen_parallel.h"
+#include "math.h"
+using namespace hls;
+using namespace std;
+
+#define MAX_IMAGES 2
+
+void Testbench_parallel(stream<ap_uint<SIMD*INPUT_PRECISION> > & in0, stream<ap_uint<KERNEL_DIM0*KERNEL_DIM0*SIMD*INPUT_PRECISION> > & out0,
+                        stream<ap_uint<SIMD*INPUT_PRECISION> > & in1, stream<ap_uint<KERNEL_DIM1*KERNEL_DIM1*SIMD*INPUT_PRECISION> > & out1,
+                        unsigned int numReps);
+
+static	ap_uint<INPUT_PRECISION> INPUT_IMAGES[MAX_IMAGES][IFMDim][IFMDim][IFM_Channels];
+
+template<unsigned int KernelDim, unsigned int Stride, unsigned int OFMDim>
+int check(stream<ap_uint<KernelDim*KernelDim*SIMD*INPUT_PRECISION> > & out)
+{
+	for (unsigned int n_image = 0; n_image < MAX_IMAGES; n_image++) {
+		for (unsigned int oy = 0; oy < OFMDim; oy++) {
+			for (unsigned int ox = 0; ox < OFMDim; ox++) {
+				ap_uint<KernelDim*KernelDim*SIMD*INPUT_PRECISION> outElem = out.read();
+				for (unsigned int ky = 0; ky < KernelDim; ky++) {
+					for (unsigned int kx = 0; kx < KernelDim; kx++) {
+						for (unsigned int channel = 0; channel < IFM_Channels; channel++) {
+							unsigned int const lsb = ((ky*KernelDim + kx)*IFM_Channels + channel)*INPUT_PRECISION;
+							ap_uint<INPUT_PRECISION> const out_chan = outElem(lsb+INPUT_PRECISION-1, lsb);
+							ap_uint<INPUT_PRECISION> const EXP = INPUT_IMAGES[n_image][oy*Stride+ky][ox*Stride+kx][channel];
+							if (EXP != out_chan) {
+								std::cout << "ERROR: kernel= " << KernelDim << " Expected " << EXP << " actual " <<  out_chan << std::endl;
+								std::cout << "oy= " << oy << " ox= " << ox << " ky= " << ky << " kx= " << kx << std::endl;
+								return 1;
+							}
+						}
+					}
+				}
+			}
+		}
+	}
+	if (!out.empty()) {
+		std::cout << "ERROR: kernel= " << KernelDim << " left data in the output stream" << std::endl;
+		return 1;
+	}
+	std::cout << "Kernel " << KernelDim << " stride " << Stride << " passed the testing." << std::endl;
+	return 0;
+}
+
+int main()
+{
+	stream<ap_uint<SIMD*INPUT_PRECISION> > input_stream0("input_stream0");
+	stream<ap_uint<SIMD*INPUT_PRECISION> > input_stream1("input_stream1");
+	stream<ap_uint<KERNEL_DIM0*KERNEL_DIM0*SIMD*INPUT_PRECISION> > output_stream0("output_stream0");
+	stream<ap_uint<KERNEL_DIM1*KERNEL_DIM1*SIMD*INPUT_PRECISION> > output_stream1("output_stream1");
+	unsigned int counter = 0;
+	for (unsigned int n_image = 0; n_image < MAX_IMAGES; n_image++) {
+		for (unsigned int oy = 0; oy < IFMDim; oy++) {
+			for (unsigned int ox = 0; ox < IFMDim; ox++) {
+				ap_uint<SIMD*INPUT_PRECISION> input_simd = 0;
+				for (unsigned int channel = 0; channel < IFM_Channels; channel++) {
+					ap_uint<INPUT_PRECISION> input = (ap_uint<INPUT_PRECISION>)(counter++);
+					INPUT_IMAGES[n_image][oy][ox][channel] = input;
+					input_simd((channel+1)*INPUT_PRECISION-1, channel*INPUT_PRECISION) = input;
+				}
+				input_stream0.write(input_simd);
+				input_stream1.write(input_simd);
+			}
+		}
+	}
+	Testbench_parallel(input_stream0, output_stream0, input_stream1, output_stream1, MAX_IMAGES);
+	if (!input_stream0.empty() || !input_stream1.empty()) {
+		std::cout << "ERROR: left data in the input streams" << std::endl;
+		return 1;
+	}
+	int err = 0;
+	err |= check<KERNEL_DIM0, STRIDE0, OFMDim0>(output_stream0);
+	err |= check<KERNEL_DIM1, STRIDE1, OFMDim1>(output_stream1);
+	return err;
+}
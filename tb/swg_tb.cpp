@@ -38,10 +38,13 @@
  *  Testbench for the sliding window generator HLS block
  *
  *****************************************************************************/
+#define FINN_HLSLIB_COUNT_ITERATIONS 1
+
 #include <hls_stream.h>
 #include "ap_int.h"
 #include <iostream>
 #include <string>
+#include "costmodel.hpp"
 #include "data/input_gen.h"
 #include "math.h"
 using namespace hls;
@@ -100,6 +103,17 @@ stream<ap_uint<IFM_Channels*INPUT_PRECISION> > output_stream("output_stream");
 		}
 		std::cout << "Image # " << n_image << std::endl;
 	}
+#ifndef __RTL_SIMULATION__
+	constexpr unsigned long long cost_cycles = cost::ConvolutionInputGenerator<KERNEL_DIM, IFM_Channels, INPUT_PRECISION,
+		IFMDim, OFMDim, SIMD, STRIDE>::cycles_per_image;
+	for (unsigned int n_image = 0; n_image < MAX_IMAGES; n_image++) {
+		if (cost::iteration_log().at(n_image) != cost_cycles) {
+			std::cout << "ERROR: image " << n_image << " took " << cost::iteration_log()[n_image] << " cycles, cost model "
+			          << cost_cycles << std::endl;
+			return 1;
+		}
+	}
+#endif
 	return 0;
 
 }
@@ -0,0 +1,104 @@
+/******************************************************************************
+ *  Copyright (c) 2026, Advanced Micro Devices, Inc.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *
+ *  1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *
+ *  2.  Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ *  3.  Neither the name of the copyright holder nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION). HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ *  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************/
+/******************************************************************************
+ *
+ *  \file thresholds_binsearch_tb.cpp
+ *
+ *  Testbench for the Thresholding_Batch layer using binary search thresholds
+ *
+ *****************************************************************************/
+
+#include <iostream>
+#include <cmath>
+#include <cstring>
+#include <hls_stream.h>
+#include <cstdlib>
+#define AP_INT_MAX_W 8191
+#include "ap_int.h"
+#include "bnn-library.h"
+using namespace hls;
+using namespace std;
+
+#include "thresholds_binsearch_top.h"
+
+#define MAX_IMAGES 4
+
+int main()
+{
+    int IMAGE[MAX_IMAGES][IFMDim*IFMDim][FM_Channels];
+    stream<ap_uint<FM_Channels*INPUT_BITS> > input_stream("input_stream");
+    stream<ap_uint<FM_Channels*OUTPUT_BITS> > output_stream("output_stream");
+
+    // sweep the whole input range
+    unsigned int counter = 0;
+    for (unsigned int n_image = 0; n_image < MAX_IMAGES; n_image++) {
+        for (unsigned int px = 0; px < IFMDim*IFMDim; px++) {
+            ap_uint<FM_Channels*INPUT_BITS> input_channel = 0;
+            for (unsigned int channel = 0; channel < FM_Channels; channel++) {
+                IN_T input = (IN_T)(counter);
+                IMAGE[n_image][px][channel] = input;
+                input_channel((channel+1)*INPUT_BITS-1, channel*INPUT_BITS) = input;
+                counter++;
+            }
+            input_stream.write(input_channel);
+        }
+    }
+
+    Testbench_thresholds_binsearch(input_stream, output_stream, MAX_IMAGES);
+
+    int err_counter = 0;
+    for (unsigned int n_image = 0; n_image < MAX_IMAGES; n_image++) {
+        for (unsigned int px = 0; px < IFMDim*IFMDim; px++) {
+            ap_uint<FM_Channels*OUTPUT_BITS> outElem = output_stream.read();
+            for (unsigned int channel = 0; channel < FM_Channels; channel++) {
+                int const f_idx = channel / PE;
+                int const pe_idx = channel % PE;
+                // reference: count all passed thresholds
+                unsigned expected = 0;
+                for (unsigned int t = 0; t < NumTH; t++) {
+                    expected += thresholds_init[pe_idx][f_idx][t] < IMAGE[n_image][px][channel];
+                }
+                OUT_T const produced = outElem((channel+1)*OUTPUT_BITS-1, channel*OUTPUT_BITS);
+                if (expected != produced) {
+                    std::cout << "ERROR: Expected[" << n_image << "][" << px << "][" << channel << "]="
+                              << expected << " actual " << produced
+                              << " | input value: " << IMAGE[n_image][px][channel] << std::endl;
+                    err_counter++;
+                }
+            }
+        }
+    }
+    if (err_counter == 0) {
+        std::cout << "Test passed." << std::endl;
+    }
+    return err_counter;
+}
@@ -0,0 +1,72 @@
+/******************************************************************************
+ *  Copyright (c) 2026, Advanced Micro Devices, Inc.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *
+ *  1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *
+ *  2.  Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ *  3.  Neither the name of the copyright holder nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION). HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ *  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************/
+/******************************************************************************
+ *
+ *  \file thresholds_binsearch_top.h
+ *
+ *  Configuration of the Thresholding_Batch test with binary search thresholds
+ *
+ *****************************************************************************/
+#ifndef THRESHOLDS_BINSEARCH_TOP_H
+#define THRESHOLDS_BINSEARCH_TOP_H
+
+#include <hls_stream.h>
+using namespace hls;
+#include "ap_int.h"
+#include "bnn-library.h"
+
+#include "activations.hpp"
+#include "interpret.hpp"
+
+#define PE 2
+#define FM_Channels 4
+#define IFMDim 4
+#define NumTH 15
+
+#define INPUT_BITS 8
+#define OUTPUT_BITS 4
+
+#define IN_T ap_int<INPUT_BITS>
+#define OUT_T ap_uint<OUTPUT_BITS>
+
+#define FOLD (FM_Channels/PE)
+
+// thresholds sorted in ascending order per channel
+#define THRESHOLDS_INIT {{{-108, -106, -102, -96, -82, -66, -38, -27, -19, 9, 17, 29, 46, 90, 112}, {-111, -105, -103, -98, -97, -89, -63, -59, -13, -12, -9, 21, 24, 41, 91}}, \
+  {{-109, -108, -105, -86, -84, -64, -46, -19, -13, 18, 22, 27, 29, 40, 99}, {-96, -94, -90, -74, -72, -42, -25, 20, 23, 26, 28, 43, 54, 62, 88}}}
+
+const int thresholds_init[PE][FOLD][NumTH] = THRESHOLDS_INIT;
+
+void Testbench_thresholds_binsearch(stream<ap_uint<FM_Channels*INPUT_BITS> > & in,
+                    stream<ap_uint<FM_Channels*OUTPUT_BITS> > & out, unsigned int numReps);
+
+#endif
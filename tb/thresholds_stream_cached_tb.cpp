@@ -0,0 +1,129 @@
+/******************************************************************************
+ *  Copyright (c) 2026, Advanced Micro Devices, Inc.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *
+ *  1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *
+ *  2.  Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ *  3.  Neither the name of the copyright holder nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION). HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ *  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************/
+/******************************************************************************
+ *
+ *  \file thresholds_stream_cached_tb.cpp
+ *
+ *  Testbench for the Thresholding_Stream_Cached_Batch layer
+ *
+ *****************************************************************************/
+
+#include <iostream>
+#include <cmath>
+#include <cstring>
+#include <hls_stream.h>
+#include <cstdlib>
+#define AP_INT_MAX_W 8191
+#include "ap_int.h"
+#include "bnn-library.h"
+using namespace hls;
+using namespace std;
+
+#include "thresholds_stream_cached_top.h"
+
+#define MAX_IMAGES 3
+
+int run(bool reload)
+{
+    static int IMAGE[MAX_IMAGES][IFMDim*IFMDim][FM_Channels];
+    static int THRESH[MAX_IMAGES][FM_Channels][NumTH];
+    stream<ap_uint<PE*INPUT_BITS> > input_stream("input_stream");
+    stream<ap_uint<PE*OUTPUT_BITS> > output_stream("output_stream");
+    stream<ap_uint<PE*NumTH*THRESHOLD_BITS> > thresh_stream("thresh_stream");
+
+    for (unsigned int n_image = 0; n_image < MAX_IMAGES; n_image++) {
+        // a new set of thresholds per image, or a single one for the batch
+        for (unsigned int channel = 0; channel < FM_Channels; channel++) {
+            for (unsigned int t = 0; t < NumTH; t++) {
+                THRESH[n_image][channel][t] = (reload || n_image == 0)? (int)TH_T(rand()) : THRESH[0][channel][t];
+            }
+        }
+        if (reload || n_image == 0) {
+            for (unsigned int nf = 0; nf < FOLD; nf++) {
+                ap_uint<PE*NumTH*THRESHOLD_BITS> packed_thr;
+                for (unsigned int pe = 0; pe < PE; pe++)
+                    for (unsigned int t = 0; t < NumTH; t++)
+                        packed_thr(((pe*NumTH)+t+1)*THRESHOLD_BITS-1, ((pe*NumTH)+t)*THRESHOLD_BITS) = TH_T(THRESH[n_image][nf*PE+pe][t]);
+                thresh_stream.write(packed_thr);
+            }
+        }
+        for (unsigned int px = 0; px < IFMDim*IFMDim; px++) {
+            for (unsigned int nf = 0; nf < FOLD; nf++) {
+                ap_uint<PE*INPUT_BITS> inElem;
+                for (unsigned int pe = 0; pe < PE; pe++) {
+                    IN_T const input = (IN_T)(rand());
+                    IMAGE[n_image][px][nf*PE+pe] = input;
+                    inElem((pe+1)*INPUT_BITS-1, pe*INPUT_BITS) = input;
+                }
+                input_stream.write(inElem);
+            }
+        }
+    }
+
+    Testbench_thresholds_stream_cached(input_stream, output_stream, thresh_stream, MAX_IMAGES, reload);
+
+    int err_counter = 0;
+    for (unsigned int n_image = 0; n_image < MAX_IMAGES; n_image++) {
+        for (unsigned int px = 0; px < IFMDim*IFMDim; px++) {
+            for (unsigned int nf = 0; nf < FOLD; nf++) {
+                ap_uint<PE*OUTPUT_BITS> outElem = output_stream.read();
+                for (unsigned int pe = 0; pe < PE; pe++) {
+                    unsigned const channel = nf*PE+pe;
+                    unsigned expected = 0;
+                    for (unsigned int t = 0; t < NumTH; t++) {
+                        expected += THRESH[n_image][channel][t] <= IMAGE[n_image][px][channel];
+                    }
+                    OUT_T const produced = outElem((pe+1)*OUTPUT_BITS-1, pe*OUTPUT_BITS);
+                    if (expected != produced) {
+                        std::cout << "ERROR: Expected[" << n_image << "][" << px << "][" << channel << "]="
+                                  << expected << " actual " << produced << std::endl;
+                        err_counter++;
+                    }
+                }
+            }
+        }
+    }
+    if (!thresh_stream.empty()) {
+        std::cout << "ERROR: Unconsumed thresholds." << std::endl;
+        err_counter++;
+    }
+    return err_counter;
+}
+
+int main()
+{
+    int err_counter = run(true) + run(false);
+    if (err_counter == 0) {
+        std::cout << "Test passed." << std::endl;
+    }
+    return err_counter;
+}
@@ -0,0 +1,70 @@
+/******************************************************************************
+ *  Copyright (c) 2026, Advanced Micro Devices, Inc.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *
+ *  1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ *
+ *  2.  Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ *  3.  Neither the name of the copyright holder nor the names of its
+ *      contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ *  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ *  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ *  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ *  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ *  OR BUSINESS INTERRUPTION). HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ *  WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ *  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ *  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************/
+/******************************************************************************
+ *
+ *  \file thresholds_stream_cached_top.h
+ *
+ *  Configuration of the Thresholding_Stream_Cached_Batch test
+ *
+ *****************************************************************************/
+#ifndef THRESHOLDS_STREAM_CACHED_TOP_H
+#define THRESHOLDS_STREAM_CACHED_TOP_H
+
+#include <hls_stream.h>
+using namespace hls;
+#include "ap_int.h"
+#include "bnn-library.h"
+
+#include "activations.hpp"
+#include "interpret.hpp"
+
+#define PE 2
+#define FM_Channels 6
+#define IFMDim 3
+#define NumTH 3
+
+#define INPUT_BITS 8
+#define THRESHOLD_BITS 8
+#define OUTPUT_BITS 2
+
+#define IN_T ap_int<INPUT_BITS>
+#define TH_T ap_int<THRESHOLD_BITS>
+#define OUT_T ap_uint<OUTPUT_BITS>
+
+#define FOLD (FM_Channels/PE)
+
+void Testbench_thresholds_stream_cached(stream<ap_uint<PE*INPUT_BITS> > & in,
+                    stream<ap_uint<PE*OUTPUT_BITS> > & out,
+                    stream<ap_uint<PE*NumTH*THRESHOLD_BITS> > & thresholds,
+                    unsigned int numReps, bool reload);
+
+#endif
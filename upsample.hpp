@@ -144,6 +144,107 @@ void UpsampleNearestNeighbour_Batch(
   }
 }
 
+/**
+ * \brief Rearranges Scale x Scale blocks of channels into Scale x Scale pixels (depth to space), e.g. the
+ * phases of a transposed convolution computed on ConvolutionInputGenerator_Transposed windows. Works with square feature maps
+ *
+ * Every input pixel holds Scale*Scale*NumChannels channels, as Scale*Scale words of NumChannels channels
+ * in (row, column) order, which become the Scale x Scale output pixels it covers. Crop pixels are dropped at
+ * the top and left and CropBehind pixels at the bottom and right of the output feature map (e.g. the padding
+ * of the transposed convolution).
+ * Input and output of consecutive rows overlap by double buffering one row of input pixels.
+ *
+ * \tparam 	IFMDim 		Size of the input feature map
+ * \tparam 	Scale 		Upsampling factor
+ * \tparam 	NumChannels 	Amount of channels of the output feature map
+ * \tparam 	Crop 		Pixels dropped at the top and left of the output feature map
+ * \tparam 	In_t		 	Input datatype
+ * \tparam 	CropBehind 	Pixels dropped at the bottom and right of the output feature map
+ *
+ * \param 	in 			Input stream
+ * \param 	out 			Output stream
+ */
+template<unsigned int IFMDim,
+	unsigned int Scale,
+	unsigned int NumChannels,
+	unsigned int Crop,
+	typename In_t,
+	unsigned int CropBehind = Crop>
+void DepthToSpace(
+        hls::stream<ap_uint<NumChannels * In_t::width>> & in,
+        hls::stream<ap_uint<NumChannels * In_t::width>> & out
+) {
+  static_assert(Crop + CropBehind < IFMDim*Scale, "");
+  constexpr unsigned int OFMDim = IFMDim*Scale - Crop - CropBehind;
+  constexpr unsigned int RowLength = IFMDim*Scale;
+
+  ap_uint<NumChannels * In_t::width> RowBuf[2][Scale][RowLength];
+#pragma HLS ARRAY_PARTITION variable=RowBuf complete dim=1
+#pragma HLS DEPENDENCE variable=RowBuf inter false
+  unsigned int bank = 0;
+  // one more row to flush the last buffered one
+  for (unsigned int y = 0; y < IFMDim + 1; y++) {
+	unsigned int in_x = 0, in_py = 0, in_px = 0;
+	unsigned int out_py = 0, out_x = 0;
+	for (unsigned int i = 0; i < RowLength*Scale; i++) {
+#pragma HLS pipeline style=flp II=1
+		if (y < IFMDim) {
+			RowBuf[bank][in_py][in_x + in_px] = in.read();
+			in_px++;
+			if (in_px == Scale) {
+				in_px = 0;
+				in_py++;
+				if (in_py == Scale) {
+					in_py = 0;
+					in_x += Scale;
+				}
+			}
+		}
+		if (y > 0) {
+			unsigned int const  oy = (y - 1)*Scale + out_py;
+			if ((oy >= Crop) && (oy < Crop + OFMDim) && (out_x >= Crop) && (out_x < Crop + OFMDim)) {
+				out.write(RowBuf[1 - bank][out_py][out_x]);
+			}
+			out_x++;
+			if (out_x == RowLength) {
+				out_x = 0;
+				out_py++;
+			}
+		}
+	}
+	bank = 1 - bank;
+  }
+}
+
+/**
+ * \brief Depth to space rearrangement on multiple images. Works with square feature maps
+ *
+ * \tparam 	IFMDim 		Size of the input feature map
+ * \tparam 	Scale 		Upsampling factor
+ * \tparam 	NumChannels 	Amount of channels of the output feature map
+ * \tparam 	Crop 		Pixels dropped at the top and left of the output feature map
+ * \tparam 	In_t		 	Input datatype
+ * \tparam 	CropBehind 	Pixels dropped at the bottom and right of the output feature map
+ *
+ * \param 	in 			Input stream
+ * \param 	out 			Output stream
+ * \param     numReps      Number of time the function has to be repeatedly executed (e.g. number of images)
+ */
+template<unsigned int IFMDim,
+	unsigned int Scale,
+	unsigned int NumChannels,
+	unsigned int Crop,
+	typename In_t,
+	unsigned int CropBehind = Crop>
+void DepthToSpace_Batch(
+        hls::stream<ap_uint<NumChannels * In_t::width>> & in,
+        hls::stream<ap_uint<NumChannels * In_t::width>> & out,
+		unsigned int numReps) {
+  for (unsigned int rep = 0; rep < numReps; rep++) {
+	DepthToSpace<IFMDim, Scale, NumChannels, Crop, In_t, CropBehind>(in, out);
+  }
+}
+
 /**
  * \brief Upsampling a vector with the Nearest Neighbour algorithm.
  *
@@ -53,12 +53,20 @@
 #include <iostream>
 #include <fstream>
 #include <cstddef>
+#include <initializer_list>
 
 //- Static Evaluation of ceil(log2(x)) ---------------------------------------
 constexpr unsigned clog2(size_t  x) {
   return  x<2? 0 : 1+clog2((x+1)/2);
 }
 
+//- Static Evaluation of the sum of a list (e.g. an expanded parameter pack) --
+constexpr unsigned sum_of(std::initializer_list<unsigned>  values) {
+  unsigned  sum = 0;
+  for(unsigned const  v : values)  sum += v;
+  return  sum;
+}
+
 //- Helpers to get hold of types ---------------------------------------------
 template<typename T> struct first_param {};
 template<typename R, typename A, typename... Args>
@@ -66,14 +74,34 @@ struct first_param<R (*)(A, Args...)> { typedef A  type; };
 template<typename C, typename R, typename A, typename... Args>
 struct first_param<R (C::*)(A, Args...)> { typedef A  type; };
 
+//- Pipeline Register --------------------------------------------------------
+/**
+ * \brief   Value of d delayed by one clock cycle when used within a pipeline
+ *
+ * Cuts the combinational path from the operations computing d to those using it,
+ * which HLS could otherwise chain into the same cycle.
+ */
+template<typename T>
+T pipeline_reg(T const  d) {
+#pragma HLS INLINE off
+#pragma HLS PIPELINE II=1
+#pragma HLS LATENCY min=1 max=1
+  return  d;
+}
+
 //- Resource Representatives -------------------------------------------------
 class ap_resource_dflt {};
 class ap_resource_lut {};
 class ap_resource_dsp {};
+class ap_resource_dsp_packed {};
 //- Resource Representatives for sliding window-------------------------------
 class ap_resource_lutram {};
 class ap_resource_bram {};
 class ap_resource_uram {};
+//- Padding Representatives for sliding window--------------------------------
+class ap_padding_zero {};
+template<int V> class ap_padding_const {};
+class ap_padding_replicate {};
 
 /**
  * \brief   Stream logger - Logging call to dump on file - not synthezisable
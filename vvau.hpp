@@ -47,7 +47,36 @@
 #include "hls_stream.h"
 
 #include "mac.hpp"
+#include "activations.hpp"
 #include "interpret.hpp"
+#include "costmodel.hpp"
+
+/**
+ * \brief Kernel tap view of an interpreted VVAU input word
+ *
+ * The input word of the VVAU carries SIMD kernel taps of PE channels each,
+ * tap-major (tap s of channel pe sits at index s*PE + pe). The view exposes the
+ * SIMD taps of a single channel so that they can be reduced by mac.
+ *
+ * \tparam PE         Number of channels per tap in the input word
+ * \tparam TC         Type of the interpreted input container
+ */
+template<unsigned PE, typename TC>
+class VvauTaps {
+  TC const &m_act;
+  unsigned const  m_pe;
+
+ public:
+  VvauTaps(TC const &act, unsigned const  pe) : m_act(act), m_pe(pe) {
+#pragma HLS inline
+  }
+
+ public:
+  auto operator()(unsigned const  s, unsigned const  mmv) const -> decltype(m_act(0, mmv)) {
+#pragma HLS inline
+    return  m_act(s*PE + m_pe, mmv);
+  }
+};
 
 /**
  * \brief Vector vector activate function
@@ -55,10 +84,13 @@
  * The function performs the multiplication between a weigth vector and the input activation vector,
  * accumulating the results and then applying an activation function on the accumulated result.
  * It is used to implement depth-wise separable convolution
+ * The input stream carries SIMD kernel taps of PE channels per word (see VvauTaps), as
+ * generated by ConvolutionInputGenerator_dws; the SIMD products of each channel are reduced
+ * by an adder tree.
  * 
  * \tparam Channels   Number of channels
  * \tparam Kernel_2   Kernel * Kernel dimension (Kernel ^ 2 if square)
- * \tparam SIMD       Number of input columns computed in parallel, must be set to 1
+ * \tparam SIMD       Number of kernel taps computed in parallel, must divide Kernel_2
  * \tparam PE         Number of output rows computed in parallel
  * \tparam MMV        Number of output pixels computed in parallel
  * \tparam TSrcI      DataType of the input activation (as used in the MAC)
@@ -89,7 +121,7 @@ void Vector_Vector_Activate_Batch(hls::stream<TI> &in,
 				  int const  reps,
 				  R const &r) {
 
-  static_assert(SIMD == 1, "SIMD parallelism not yet supported.");
+  static_assert(Kernel_2 % SIMD == 0, "Kernel_2 must be a multiple of SIMD.");
 
   // how many different rows each neuron will compute
   // alternatively: number of vertical matrix chunks
@@ -97,10 +129,13 @@ void Vector_Vector_Activate_Batch(hls::stream<TI> &in,
 
   // how many synapse groups each row is split into
   // alternatively: number of horizontal matrix chunks
-  // always equal to # kernel pixels since no SIMD
-  unsigned const  SF = Kernel_2;
+  unsigned const  SF = Kernel_2 / SIMD;
   decltype(activation.init(0,0))  accu[MMV][PE];
 #pragma HLS ARRAY_PARTITION variable=accu complete dim=0
+  static_assert(!FINN_HLSLIB_CHECK_ACCU_WIDTH || mac_accumulator_fits<decltype(activation.init(0,0)), Kernel_2,
+      mac_weight_t<decltype(TWeightI()(weights.weights(0)[0]))>,
+      mac_input_t<decltype(TSrcI()(std::declval<TI const&>(), 0))>>(),
+    "Accumulator is too narrow for Kernel_2 products of the given operand types.");
 
   unsigned  nf   = 0;
   unsigned  sf   = 0;
@@ -108,6 +143,10 @@ void Vector_Vector_Activate_Batch(hls::stream<TI> &in,
   // everything merged into a common iteration space (one "big" loop instead
   // of smaller nested loops) to get the pipelinening the way we want
   unsigned const TOTAL_FOLD = NF * SF ;//* Channels/SIMD;
+  // the cost model accounts for the weights and one SIMD x PE tile of MACs per cycle
+  typedef cost::Vector_Vector_Activate_Batch<Channels, Kernel_2, SIMD, PE, MMV, cost::weight_bits<TW>::value>  KernelCost;
+  static_assert(KernelCost::buffer_bits == Channels * Kernel_2 * cost::weight_bits<TW>::value, "");
+  static_assert(KernelCost::cycles_per_image == TOTAL_FOLD, "");
   for(unsigned  i = 0; i < reps * TOTAL_FOLD; i++) {
 #pragma HLS pipeline style=flp II=1
     TI  inElem;
@@ -129,7 +168,7 @@ void Vector_Vector_Activate_Batch(hls::stream<TI> &in,
       auto const  wgt = TWeightI()(w[pe]);
       for (unsigned mmv = 0; mmv < MMV; mmv++){
         auto const  act = TSrcI()(inElem, mmv);
-		accu[mmv][pe] += mul(wgt[0], act(pe,mmv), r);
+        accu[mmv][pe] = mac<SIMD>(accu[mmv][pe], wgt, VvauTaps<PE, decltype(act)>(act, pe), r, mmv);
       }
     }
 
@@ -157,17 +196,61 @@ void Vector_Vector_Activate_Batch(hls::stream<TI> &in,
 }
 
 
+/**
+ * \brief Vector vector activate function without activation
+ *
+ * Outputs the accumulated results through a MacPassThroughActivation, i.e. in the smallest accumulator
+ * that holds Kernel_2 products of the weight and input types. TDstI has to interpret the output with that
+ * type, e.g. Slice<MacAccumulator<Kernel_2, TWeight, TInput>::type>.
+ *
+ * \tparam Channels   Number of channels
+ * \tparam Kernel_2   Kernel * Kernel dimension (Kernel ^ 2 if square)
+ * \tparam SIMD       Number of kernel taps computed in parallel, must divide Kernel_2
+ * \tparam PE         Number of output rows computed in parallel
+ * \tparam MMV        Number of output pixels computed in parallel
+ * \tparam TSrcI      DataType of the input activation (as used in the MAC)
+ * \tparam TDstI      DataType of the output activation (the inferred accumulator)
+ * \tparam TWeightI   DataType of the weights and how to access them in the array
+ * \tparam TI         DataType of the input stream - safely deducible from the paramaters
+ * \tparam TO         DataType of the output stream - safely deducible from the paramaters
+ * \tparam TW         DataType of the weights matrix - safely deducible from the paramaters
+ * \tparam R          Datatype for the resource used for FPGA implementation of the MAC  - safely deducible from the paramaters
+ *
+ * \param in          Input stream
+ * \param out         Output stream
+ * \param weights     Weights matrix (currently supports BinaryWeights or FixedPointWeights)
+ * \param reps        Number of time the function has to be repeatedly executed (e.g. number of images)
+ * \param r           Resource type for the hardware implementation of the MAC block
+ */
+template<
+  unsigned Channels, unsigned Kernel_2, unsigned SIMD, unsigned PE, unsigned MMV,
+  typename TSrcI = Identity, typename TDstI = Identity, typename TWeightI = Identity,
+  typename TI, typename TO, typename TW, typename R
+>
+void Vector_Vector_Activate_Batch(hls::stream<TI> &in,
+				  hls::stream<TO> &out,
+				  TW  const &weights,
+				  int const  reps,
+				  R const &r) {
+#pragma HLS inline
+  using  TWgt = mac_weight_t<decltype(TWeightI()(weights.weights(0)[0]))>;
+  using  TInp = mac_input_t<decltype(TSrcI()(std::declval<TI const&>(), 0))>;
+  Vector_Vector_Activate_Batch<Channels, Kernel_2, SIMD, PE, MMV, TSrcI, TDstI, TWeightI>
+    (in, out, weights, MacPassThroughActivation<Kernel_2, TWgt, TInp>(), reps, r);
+}
+
 /**
  * \brief Vector vector activate with streaming weights
  *
  * The function performs the multiplication between a weigth vector and the input activation vector,
  * accumulating the results and then applying an activation function on the accumulated result.
  * It is used to implement depth-wise separable convolution. The weights are supplied from a stream
- * input to facilitate memory-compute decoupling.
+ * input to facilitate memory-compute decoupling. The input stream carries SIMD kernel taps of
+ * PE channels per word (see VvauTaps).
  * 
  * \tparam Channels   Number of channels
  * \tparam Kernel_2   Kernel * Kernel dimension (Kernel ^ 2 if square)
- * \tparam SIMD       Number of input columns computed in parallel, must be set to 1
+ * \tparam SIMD       Number of kernel taps computed in parallel, must divide Kernel_2
  * \tparam PE         Number of output rows computed in parallel
  * \tparam MMV        Number of output pixels computed in parallel
  * \tparam TSrcI      DataType of the input activation (as used in the MAC)
@@ -199,7 +282,7 @@ void Vector_Vector_Activate_Stream_Batch(
 	int const  reps,
 	R const &r
 ) {
-	static_assert(SIMD == 1, "SIMD parallelism not yet supported.");
+	static_assert(Kernel_2 % SIMD == 0, "Kernel_2 must be a multiple of SIMD.");
 
 	// how many different rows each neuron will compute
 	// alternatively: number of vertical matrix chunks
@@ -207,10 +290,13 @@ void Vector_Vector_Activate_Stream_Batch(
 
 	// how many synapse groups each row is split into
 	// alternatively: number of horizontal matrix chunks
-	// always equal to # kernel pixels since no SIMD
-	constexpr unsigned  SF = Kernel_2;
+	constexpr unsigned  SF = Kernel_2 / SIMD;
 	decltype(activation.init(0,0))  accu[MMV][PE];
 #pragma HLS ARRAY_PARTITION variable=accu complete dim=0
+	static_assert(!FINN_HLSLIB_CHECK_ACCU_WIDTH || mac_accumulator_fits<decltype(activation.init(0,0)), Kernel_2,
+			mac_weight_t<decltype(TWeightI()(std::declval<std::array<TW, SIMD> const&>()))>,
+			mac_input_t<decltype(TSrcI()(std::declval<TI const&>(), 0))>>(),
+		"Accumulator is too narrow for Kernel_2 products of the given operand types.");
 
 	// unpacked and packed buffers for weight stream
 	unsigned  nf   = 0;
@@ -219,6 +305,10 @@ void Vector_Vector_Activate_Stream_Batch(
 	// everything merged into a common iteration space (one "big" loop instead
 	// of smaller nested loops) to get the pipelinening the way we want
 	constexpr unsigned  TOTAL_FOLD = NF * SF ;//* Channels/SIMD;
+	// the cost model accounts for one SIMD x PE tile of MACs per cycle, the weights are not stored
+	typedef cost::Vector_Vector_Activate_Batch<Channels, Kernel_2, SIMD, PE, MMV, 0>  KernelCost;
+	static_assert(KernelCost::buffer_bits == 0, "");
+	static_assert(KernelCost::cycles_per_image == TOTAL_FOLD, "");
 	for(unsigned  i = 0; i < reps * TOTAL_FOLD; i++) {
 #pragma HLS pipeline style=flp II=1
 		TI  inElem;
@@ -247,7 +337,7 @@ void Vector_Vector_Activate_Stream_Batch(
 			auto const  wgt = TWeightI()(w[pe]);
 			for(unsigned mmv = 0; mmv < MMV; mmv++) {
 				auto const  act = TSrcI()(inElem, mmv);
-				accu[mmv][pe] += mul(wgt[0], act(pe,mmv), r);
+				accu[mmv][pe] = mac<SIMD>(accu[mmv][pe], wgt, VvauTaps<PE, decltype(act)>(act, pe), r, mmv);
 			}
 		}
 
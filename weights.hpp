@@ -54,6 +54,8 @@
 #include <ap_int.h>
 #include <array>
 
+#include "utils.hpp"
+
 
 /**
  * \brief      A binary weight storage adapter that translates the internal 
@@ -66,6 +68,7 @@
 template<unsigned SIMD, unsigned PE, unsigned TILES>
 class BinaryWeights {
  public:
+  static constexpr unsigned  WEIGHT_BITS = 1;
   ap_uint<SIMD>  m_weights[PE][TILES];
 
  private:
@@ -110,6 +113,7 @@ class BinaryWeights {
 template<unsigned SIMD, typename WT ,unsigned PE, unsigned TILES>
 class FixedPointWeights {
  public:
+  static constexpr unsigned  WEIGHT_BITS = WT::width;
   ap_uint<SIMD*WT::width>  m_weights[PE][TILES];
 
  private:
@@ -148,6 +152,279 @@ class FixedPointWeights {
 };
 
 
+/**
+ * \brief      A runtime-writable binary weight storage adapter.
+ *
+ * Provides the same weights(tile)[pe] access as BinaryWeights on top of an
+ * external memory of BANKS weight sets, e.g. a top-level array argument mapped
+ * to an AXI-lite or BRAM interface that the host writes at runtime. The bank
+ * read by the MVAU is selected at construction so that a new weight set can be
+ * loaded into another bank while the current batch is processed. The PE rows of
+ * a tile are packed into one word, lane pe in bits [(pe+1)*SIMD-1:pe*SIMD], so
+ * that a single memory port serves all PE lanes with one read per cycle.
+ *
+ * \tparam     SIMD   Number of input columns (channels) computed in parallel
+ * \tparam     PE     Number of output rows (channels) computed in parallel
+ * \tparam     TILES  3rd dimension of the weights matrix
+ * \tparam     BANKS  Number of weight sets held by the memory
+ */
+template<unsigned SIMD, unsigned PE, unsigned TILES, unsigned BANKS = 2>
+class RuntimeBinaryWeights {
+ public:
+  static constexpr unsigned  WEIGHT_BITS = 1;
+  ap_uint<PE*SIMD>  const (&m_weights)[BANKS][TILES];
+  unsigned          const  m_bank;
+
+ public:
+  RuntimeBinaryWeights(ap_uint<PE*SIMD> const (&weights)[BANKS][TILES], unsigned const  bank)
+    : m_weights(weights), m_bank(bank) {
+#pragma HLS inline
+  }
+
+ private:
+  /**
+   * Temporary container for the tile index to implement the
+   * memory access in pe -> tile order.
+   */
+  class TileIndex {
+    RuntimeBinaryWeights const &m_par;
+    unsigned             const  m_idx;
+
+   public:
+    TileIndex(RuntimeBinaryWeights const &par, unsigned const  idx)
+      : m_par(par), m_idx(idx) {
+#pragma HLS inline
+    }
+
+   public:
+    ap_uint<SIMD> operator[](unsigned const  pe) const {
+#pragma HLS inline
+      return  m_par.m_weights[m_par.m_bank][m_idx]((pe+1)*SIMD-1, pe*SIMD);
+    }
+  };
+
+ public:
+  TileIndex weights(unsigned const  tile) const {
+#pragma HLS inline
+    return  TileIndex(*this, tile);
+  }
+};
+
+
+/**
+ * \brief      A runtime-writable fixed point weight storage adapter.
+ *
+ * Provides the same weights(tile)[pe] access as FixedPointWeights on top of an
+ * external memory of BANKS weight sets, see RuntimeBinaryWeights. Lane pe of a
+ * tile is packed in bits [(pe+1)*SIMD*WT::width-1:pe*SIMD*WT::width].
+ *
+ * \tparam     SIMD   Number of input columns (channels) computed in parallel
+ * \tparam     WT     Datatype of the weights
+ * \tparam     PE     Number of output rows (channels) computed in parallel
+ * \tparam     TILES  3rd dimension of the weights matrix
+ * \tparam     BANKS  Number of weight sets held by the memory
+ */
+template<unsigned SIMD, typename WT, unsigned PE, unsigned TILES, unsigned BANKS = 2>
+class RuntimeFixedPointWeights {
+ public:
+  static constexpr unsigned  WEIGHT_BITS = WT::width;
+  ap_uint<PE*SIMD*WT::width>  const (&m_weights)[BANKS][TILES];
+  unsigned                    const  m_bank;
+
+ public:
+  RuntimeFixedPointWeights(ap_uint<PE*SIMD*WT::width> const (&weights)[BANKS][TILES], unsigned const  bank)
+    : m_weights(weights), m_bank(bank) {
+#pragma HLS inline
+  }
+
+ private:
+  /**
+   * Temporary container for the tile index to implement the
+   * memory access in pe -> tile order.
+   */
+  class TileIndex {
+    RuntimeFixedPointWeights const &m_par;
+    unsigned                 const  m_idx;
+
+   public:
+    TileIndex(RuntimeFixedPointWeights const &par, unsigned const  idx)
+      : m_par(par), m_idx(idx) {
+#pragma HLS inline
+    }
+
+   public:
+    std::array<WT,SIMD> operator[](unsigned const  pe) const {
+#pragma HLS inline
+      ap_uint<SIMD*WT::width> const  lane = m_par.m_weights[m_par.m_bank][m_idx]((pe+1)*SIMD*WT::width-1, pe*SIMD*WT::width);
+      std::array<WT,SIMD>  ret;
+      for(unsigned int i=0; i<SIMD; i++) {
+#pragma HLS unroll
+        ap_int<WT::width> const  local_temp = lane((i+1)*WT::width-1, i*WT::width);
+        ret[i] = WT(local_temp);
+      }
+      return  ret;
+    }
+  };
+
+ public:
+  TileIndex weights(unsigned const  tile) const {
+#pragma HLS inline
+    return  TileIndex(*this, tile);
+  }
+};
+
+/**
+ * \brief      A block-sparse binary weight storage adapter.
+ *
+ * Stores only the non-zero SIMD x PE tiles of the weight matrix. The tiles of
+ * each neuron fold nf are stored consecutively in increasing column (synapse
+ * fold) order, starting at offset(nf) and ending before offset(nf+1), and
+ * column(t) is the synapse fold of stored tile t. cycles() is the number of
+ * cycles Matrix_Vector_Activate_Sparse_Batch spends per input vector: SF for
+ * the first neuron fold plus, for every further neuron fold, its number of
+ * stored tiles or one if it has none. It is fixed by the sparsity pattern and
+ * therefore stored alongside it rather than recomputed in the kernel.
+ *
+ * \tparam     SIMD   Number of input columns (channels) computed in parallel
+ * \tparam     PE     Number of output rows (channels) computed in parallel
+ * \tparam     SF     Number of synapse folds of the weights matrix
+ * \tparam     NF     Number of neuron folds of the weights matrix
+ * \tparam     NZ     Number of non-zero tiles stored
+ */
+template<unsigned SIMD, unsigned PE, unsigned SF, unsigned NF, unsigned NZ>
+class SparseBinaryWeights {
+ public:
+  static constexpr unsigned  WEIGHT_BITS = 1;
+  // synapse fold of every stored tile and first stored tile of every neuron fold
+  static constexpr unsigned  COLUMN_BITS = clog2(SF) > 0? clog2(SF) : 1;
+  static constexpr unsigned  OFFSET_BITS = clog2(NZ+1) > 0? clog2(NZ+1) : 1;
+  // upper bound of the cycles per input vector
+  static constexpr unsigned  MAX_CYCLES  = SF + NZ + NF - 1;
+  static constexpr unsigned  CYCLE_BITS  = clog2(MAX_CYCLES+1);
+
+  ap_uint<SIMD>  m_weights[PE][NZ];
+  ap_uint<COLUMN_BITS>  m_columns[NZ];
+  ap_uint<OFFSET_BITS>  m_offsets[NF+1];
+  ap_uint<CYCLE_BITS>   m_cycles;
+
+ private:
+  /**
+   * Temporary container for the tile index to implement the
+   * memory access in pe -> tile order.
+   */
+  class TileIndex {
+    SparseBinaryWeights const &m_par;
+    unsigned            const  m_idx;
+
+   public:
+    TileIndex(SparseBinaryWeights const &par, unsigned const  idx)
+      : m_par(par), m_idx(idx) {
+#pragma HLS inline
+    }
+
+   public:
+    ap_uint<SIMD> operator[](unsigned const  pe) const {
+#pragma HLS inline
+      return  m_par.m_weights[pe][m_idx];
+    }
+  };
+
+ public:
+  TileIndex weights(unsigned const  tile) const {
+#pragma HLS inline
+    return  TileIndex(*this, tile);
+  }
+  unsigned column(unsigned const  tile) const {
+#pragma HLS inline
+    return  m_columns[tile];
+  }
+  unsigned offset(unsigned const  nf) const {
+#pragma HLS inline
+    return  m_offsets[nf];
+  }
+  unsigned cycles() const {
+#pragma HLS inline
+    return  m_cycles;
+  }
+};
+
+
+/**
+ * \brief      A block-sparse fixed point weight storage adapter.
+ *
+ * Stores only the non-zero SIMD x PE tiles of the weight matrix, see
+ * SparseBinaryWeights for the layout.
+ *
+ * \tparam     SIMD   Number of input columns (channels) computed in parallel
+ * \tparam     WT     Datatype of the weights
+ * \tparam     PE     Number of output rows (channels) computed in parallel
+ * \tparam     SF     Number of synapse folds of the weights matrix
+ * \tparam     NF     Number of neuron folds of the weights matrix
+ * \tparam     NZ     Number of non-zero tiles stored
+ */
+template<unsigned SIMD, typename WT, unsigned PE, unsigned SF, unsigned NF, unsigned NZ>
+class SparseFixedPointWeights {
+ public:
+  static constexpr unsigned  WEIGHT_BITS = WT::width;
+  // synapse fold of every stored tile and first stored tile of every neuron fold
+  static constexpr unsigned  COLUMN_BITS = clog2(SF) > 0? clog2(SF) : 1;
+  static constexpr unsigned  OFFSET_BITS = clog2(NZ+1) > 0? clog2(NZ+1) : 1;
+  // upper bound of the cycles per input vector
+  static constexpr unsigned  MAX_CYCLES  = SF + NZ + NF - 1;
+  static constexpr unsigned  CYCLE_BITS  = clog2(MAX_CYCLES+1);
+
+  ap_uint<SIMD*WT::width>  m_weights[PE][NZ];
+  ap_uint<COLUMN_BITS>  m_columns[NZ];
+  ap_uint<OFFSET_BITS>  m_offsets[NF+1];
+  ap_uint<CYCLE_BITS>   m_cycles;
+
+ private:
+  /**
+   * Temporary container for the tile index to implement the
+   * memory access in pe -> tile order.
+   */
+  class TileIndex {
+    SparseFixedPointWeights const &m_par;
+    unsigned                const  m_idx;
+
+   public:
+    TileIndex(SparseFixedPointWeights const &par, unsigned const  idx)
+      : m_par(par), m_idx(idx) {
+#pragma HLS inline
+    }
+
+   public:
+    std::array<WT,SIMD> operator[](unsigned const  pe) const {
+#pragma HLS inline
+      std::array<WT,SIMD>  ret;
+      for(unsigned int i=0; i<SIMD; i++) {
+#pragma HLS unroll
+        ap_int<WT::width> const  local_temp = m_par.m_weights[pe][m_idx]((i+1)*WT::width-1, i*WT::width);
+        ret[i] = WT(local_temp);
+      }
+      return  ret;
+    }
+  };
+
+ public:
+  TileIndex weights(unsigned const  tile) const {
+#pragma HLS inline
+    return  TileIndex(*this, tile);
+  }
+  unsigned column(unsigned const  tile) const {
+#pragma HLS inline
+    return  m_columns[tile];
+  }
+  unsigned offset(unsigned const  nf) const {
+#pragma HLS inline
+    return  m_offsets[nf];
+  }
+  unsigned cycles() const {
+#pragma HLS inline
+    return  m_cycles;
+  }
+};
+
 template<unsigned SIMD, typename WT, unsigned PE>
 class Weights_Tile { 
 public: